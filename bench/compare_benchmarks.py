@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""
+Compares two fizziks_benchmarks runs saved with --benchmark_out=<file> --benchmark_out_format=json
+
+    python3 bench/compare_benchmarks.py before.json after.json
+
+Prints time/op for each benchmark in both files and the change. Negative change = faster.
+If the runs used --benchmark_repetitions, the medians are compared.
+"""
+
+import json
+import sys
+
+
+def load(path):
+    with open(path) as file:
+        data = json.load(file)
+
+    results = {}
+    have_medians = any(b.get("aggregate_name") == "median" for b in data["benchmarks"])
+    for benchmark in data["benchmarks"]:
+        if have_medians:
+            if benchmark.get("aggregate_name") != "median":
+                continue
+            name = benchmark["run_name"]
+        else:
+            if benchmark.get("run_type", "iteration") != "iteration":
+                continue
+            name = benchmark["name"]
+
+        # time/op is stored in seconds, fall back to the per-iteration time for benchmarks without it
+        if "time/op" in benchmark:
+            results[name] = benchmark["time/op"] * 1e9
+        else:
+            scale = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}[benchmark.get("time_unit", "ns")]
+            results[name] = benchmark["real_time"] * scale
+    return results
+
+
+def format_time(nanoseconds):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if nanoseconds >= scale:
+            return "%.2f %s" % (nanoseconds / scale, unit)
+    return "%.2f ns" % nanoseconds
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 1
+
+    before = load(sys.argv[1])
+    after = load(sys.argv[2])
+
+    names = [name for name in before if name in after]
+    width = max([len(name) for name in names] + [9])
+    print("%-*s %14s %14s %9s" % (width, "Benchmark", "before/op", "after/op", "change"))
+    for name in names:
+        change = (after[name] - before[name]) / before[name] * 100 if before[name] > 0 else 0
+        print("%-*s %14s %14s %+8.1f%%" % (width, name, format_time(before[name]), format_time(after[name]), change))
+
+    for name in before:
+        if name not in after:
+            print("only in %s: %s" % (sys.argv[1], name))
+    for name in after:
+        if name not in before:
+            print("only in %s: %s" % (sys.argv[2], name))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,254 @@
+/*
+Checks the GPU physics (FizziksComputeSolver) against its CPU reference, and times both.
+
+No window is opened: the GL context comes from EGL without a surface, so this runs on a machine with no
+GPU and no display, using Mesa's software rasterizer:
+	LIBGL_ALWAYS_SOFTWARE=1 compute_physics_check
+(on a machine with a GPU, leave LIBGL_ALWAYS_SOFTWARE out to check the real driver).
+
+Usage:
+	compute_physics_check [--circles N] [--steps N] [--frames N]
+
+The scene is the game's: circles with radius 5-30 dropped into a box made of halfspaces, strong gravity,
+lots of contacts. Two runs:
+	1. Check: --steps steps, each started from the same state on both sides. The GPU result is read back
+	   and compared with stepReference(). Every step starts from the reference result, so small float
+	   differences (the GPU adds up neighbours in a different order) can't snowball into big ones.
+	2. Timing: --frames steps in a row on the GPU, then the same on the CPU reference (single threaded). Every GPU
+	   step is binned on a fresh grid (uploadBodies), so the cell capacity keeps up with the circles piling up.
+	   The GPU is timed twice: the step alone, and the step with the upload and read back around it.
+Exits with 1 if any position or velocity is off by more than 0.01% (plus 0.0001 px), or the grid overflowed in
+either run.
+*/
+
+#include "fizziks_compute.h"
+#include "rlgl.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+///
+/// Headless GL context
+///
+
+// OpenGL 4.3 core context with no surface (EGL_MESA_platform_surfaceless / EGL_KHR_surfaceless_context)
+static bool CreateHeadlessContext()
+{
+	EGLDisplay display = EGL_NO_DISPLAY;
+	PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (getPlatformDisplay != nullptr) display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+	if (display == EGL_NO_DISPLAY) display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+	EGLint major = 0, minor = 0;
+	if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) return false;
+	if (!eglBindAPI(EGL_OPENGL_API)) return false;
+
+	const EGLint contextAttributes[] = {
+		EGL_CONTEXT_MAJOR_VERSION, 4,
+		EGL_CONTEXT_MINOR_VERSION, 3,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_NONE
+	};
+	EGLContext context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttributes);
+	if (context == EGL_NO_CONTEXT) return false;
+	return eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+}
+
+static void* EglLoader(const char* name)
+{
+	return (void*)eglGetProcAddress(name);
+}
+
+///
+/// Scene
+///
+
+const int SCREEN_WIDTH = 1600;
+const int SCREEN_HEIGHT = 900;
+
+// Circles and halfspaces are owned by the caller, the world only points at them
+static void MakeScene(FizziksWorld& world, std::vector<FizziksCircle>& circles, std::vector<FizziksHalfspace>& walls, int count)
+{
+	srand(12345); // Same scene every run
+	circles.resize(count);
+	for (FizziksCircle& circle : circles)
+	{
+		circle.position = { (float)(100 + rand() % (SCREEN_WIDTH - 200)), (float)(100 + rand() % (SCREEN_HEIGHT - 200)) };
+		circle.velocity = { (float)(rand() % 200 - 100), (float)(rand() % 200 - 100) };
+		circle.radius = (float)(rand() % 26 + 5); // Same range as the birds the game launches
+	}
+
+	// Floor, a ramp on the left and a wall on the right
+	walls.resize(3);
+	walls[0].position = { 0, SCREEN_HEIGHT - 20 };
+	walls[0].setRotationDegrees(0);
+	walls[1].position = { 20, SCREEN_HEIGHT - 200 };
+	walls[1].setRotationDegrees(30);
+	walls[2].position = { SCREEN_WIDTH - 20, 0 };
+	walls[2].setRotationDegrees(-90);
+	for (FizziksHalfspace& wall : walls)
+	{
+		wall.isStatic = true;
+		wall.grippiness = 0.5f;
+		world.add(&wall);
+	}
+
+	for (FizziksCircle& circle : circles) world.add(&circle);
+	world.accelerationGravity = { 0, 500 };
+}
+
+///
+/// Check
+///
+
+struct Difference
+{
+	float position = 0; // Worst error as a fraction of the allowed error, > 1 fails
+	float velocity = 0;
+	int touchingMismatches = 0; // Circles exactly at the edge of contact can go either way, reported but allowed
+};
+
+static float Error(Vector2 gpu, Vector2 reference)
+{
+	float allowed = 0.0001f + 0.0001f * Vector2Length(reference);
+	return Vector2Length(gpu - reference) / allowed;
+}
+
+static void Compare(const std::vector<FizziksComputeBody>& gpu, const std::vector<FizziksComputeBody>& reference, Difference& difference)
+{
+	for (size_t i = 0; i < gpu.size(); i++)
+	{
+		difference.position = fmaxf(difference.position, Error(gpu[i].position, reference[i].position));
+		difference.velocity = fmaxf(difference.velocity, Error(gpu[i].velocity, reference[i].velocity));
+		if ((gpu[i].flags ^ reference[i].flags) & FIZZIKS_COMPUTE_TOUCHING) difference.touchingMismatches++;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int circleCount = 5000;
+	int stepCount = 100;
+	int frameCount = 100;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--circles") == 0 && i + 1 < argc) circleCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--steps") == 0 && i + 1 < argc) stepCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frameCount = atoi(argv[++i]);
+		else
+		{
+			printf("usage: %s [--circles N] [--steps N] [--frames N]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (frameCount < 1) frameCount = 1;
+
+	if (!CreateHeadlessContext())
+	{
+		printf("no OpenGL 4.3 context from EGL (error 0x%x)\n", eglGetError());
+		return 1;
+	}
+	rlLoadExtensions((void*)EglLoader);
+	rlglInit(SCREEN_WIDTH, SCREEN_HEIGHT);
+	typedef const unsigned char* (*GetStringFunction)(unsigned int name);
+	GetStringFunction getString = (GetStringFunction)eglGetProcAddress("glGetString");
+	printf("GL: %s, %s\n", getString(0x1F01 /* GL_RENDERER */), getString(0x1F02 /* GL_VERSION */));
+
+	FizziksComputeSolver solver;
+	if (!solver.load())
+	{
+		printf("compute shaders failed to load\n");
+		rlglClose();
+		return 1;
+	}
+
+	FizziksWorld world;
+	std::vector<FizziksCircle> circles;
+	std::vector<FizziksHalfspace> walls;
+	MakeScene(world, circles, walls, circleCount);
+	solver.upload(world);
+
+	const float dt = 1.0f / 50;
+	const std::vector<FizziksComputeBody> startBodies = solver.bodies;
+	const std::vector<FizziksComputeHalfspace> startHalfspaces = solver.halfspaces;
+
+	// 1. Check every step against the reference
+	std::vector<FizziksComputeBody> state = startBodies;
+	std::vector<FizziksComputeHalfspace> halfspaceState = startHalfspaces;
+	Difference difference;
+	unsigned int overflow = 0;
+	int halfspaceMismatches = 0;
+	for (int step = 0; step < stepCount; step++)
+	{
+		solver.bodies = state;
+		solver.halfspaces = halfspaceState;
+		solver.uploadBodies();
+		solver.step(dt);
+		solver.readBodies();
+		overflow += solver.overflowCount();
+
+		std::vector<FizziksComputeBody> reference = state;
+		std::vector<FizziksComputeHalfspace> referenceHalfspaces = halfspaceState;
+		solver.stepReference(reference, referenceHalfspaces, dt);
+
+		Compare(solver.bodies, reference, difference);
+		for (size_t h = 0; h < referenceHalfspaces.size(); h++)
+		{
+			if (solver.halfspaces[h].touched != referenceHalfspaces[h].touched) halfspaceMismatches++;
+		}
+
+		state = reference;
+		halfspaceState = referenceHalfspaces;
+	}
+
+	// 2. Time both. The GPU twice: the steps alone, and the way the game uses it, uploading and reading back every
+	// step. Both re-bin every step with a grid worked out from where the circles are now (uploadBodies), so no cell
+	// overflows as the circles pile up. For the first, only the step and waiting for it are timed
+	solver.bodies = startBodies;
+	solver.halfspaces = startHalfspaces;
+	double gpuMilliseconds = 0;
+	unsigned int timingOverflow = 0;
+	for (int frame = 0; frame < frameCount; frame++)
+	{
+		solver.uploadBodies();
+		std::chrono::steady_clock::time_point gpuStart = std::chrono::steady_clock::now();
+		solver.step(dt);
+		timingOverflow += solver.overflowCount(); // Reading anything back waits for the GPU to finish
+		gpuMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - gpuStart).count();
+		solver.readBodies();
+	}
+
+	solver.bodies = startBodies;
+	solver.halfspaces = startHalfspaces;
+	std::chrono::steady_clock::time_point roundTripStart = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < frameCount; frame++)
+	{
+		solver.uploadBodies();
+		solver.step(dt);
+		solver.readBodies();
+	}
+	double roundTripMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - roundTripStart).count();
+
+	std::vector<FizziksComputeBody> reference = startBodies;
+	std::vector<FizziksComputeHalfspace> referenceHalfspaces = startHalfspaces;
+	std::chrono::steady_clock::time_point cpuStart = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < frameCount; frame++) solver.stepReference(reference, referenceHalfspaces, dt);
+	double cpuMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - cpuStart).count();
+
+	solver.unload();
+	rlglClose();
+
+	bool passed = difference.position <= 1 && difference.velocity <= 1 && overflow == 0 && timingOverflow == 0;
+	printf("circles: %d, grid %dx%d cells of %.0f px, %d slots per cell\n",
+		circleCount, solver.grid.columns, solver.grid.rows, solver.grid.cellSize, solver.grid.cellCapacity);
+	printf("check, %d steps: worst position error %.3f, worst velocity error %.3f (of allowed), %d touching flags and %d halfspace flags differ, %u overflowed\n",
+		stepCount, difference.position, difference.velocity, difference.touchingMismatches, halfspaceMismatches, overflow);
+	printf("time per step (ms), %d steps: GPU %.3f (%u overflowed), GPU with upload and read back %.3f, CPU reference %.3f\n",
+		frameCount, gpuMilliseconds / frameCount, timingOverflow, roundTripMilliseconds / frameCount, cpuMilliseconds / frameCount);
+	printf("%s\n", passed ? "PASS" : "FAIL");
+	return passed ? 0 : 1;
+}
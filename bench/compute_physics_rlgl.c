@@ -0,0 +1,9 @@
+/*
+rlgl on its own, without the rest of raylib or GLFW, for compute_physics_check.
+It gets its GL context and function pointers from EGL instead of a window, so it runs headless.
+rlgl's TRACELOG stays the silent default: without raylib there is no TraceLog to send it to.
+*/
+
+#define GRAPHICS_API_OPENGL_43
+#define RLGL_IMPLEMENTATION
+#include "rlgl.h"
@@ -0,0 +1,274 @@
+/*
+Micro-benchmarks for the physics kernels, using Google Benchmark (https://github.com/google/benchmark).
+
+Every benchmark takes two arguments:
+	count    number of circles
+	density  percent of the arena covered by circles. Higher density = more overlapping pairs,
+	         more circles per grid cell and more collision responses that actually do something
+
+Extra columns in the output:
+	time/op  time per operation (one pair, one circle, one Vector2...), shown with an SI suffix, e.g. 12.3n = 12.3 ns
+	bytes/op bytes of objekt state the kernel reads or writes per operation
+	bytes_per_second comes from the same number
+
+Run:
+	fizziks_benchmarks --benchmark_filter=Update --benchmark_out=before.json --benchmark_out_format=json
+Compare two builds:
+	python3 bench/compare_benchmarks.py before.json after.json
+*/
+
+#include <benchmark/benchmark.h>
+#include "fizziks.h"
+#include <vector>
+
+///
+/// Scene Setup
+///
+
+const float BENCH_RADIUS = 4; // in px, every circle is the same size so density is easy to control
+
+// Deterministic random numbers so every build benchmarks the exact same scene
+struct BenchRandom
+{
+	unsigned int state = 12345;
+
+	float next01()
+	{
+		state = state * 1664525u + 1013904223u;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	}
+};
+
+// Side of the square arena that count circles cover density percent of
+float ArenaSize(int count, int density)
+{
+	float circleArea = PI * BENCH_RADIUS * BENCH_RADIUS;
+	return sqrtf(count * circleArea * 100.0f / density);
+}
+
+// A world with count circles scattered over the arena, above a floor along its bottom edge
+struct BenchScene
+{
+	FizziksWorld world;
+	FizziksHalfspace floor;
+	std::vector<FizziksCircle*> circles;
+	std::vector<Vector2> startPositions;
+	std::vector<Vector2> startVelocities;
+
+	BenchScene(int count, int density)
+	{
+		float size = ArenaSize(count, density);
+		world.recordDebugLines = false;
+		world.accelerationGravity = { 0, 100 };
+
+		floor.isStatic = true;
+		floor.position = { 0, size };
+		floor.setRotationDegrees(0);
+		world.add(&floor);
+
+		BenchRandom random;
+		for (int i = 0; i < count; i++)
+		{
+			FizziksCircle* circle = new FizziksCircle();
+			circle->position = { random.next01() * size, random.next01() * size };
+			circle->velocity = { random.next01() * 20 - 10, random.next01() * 20 - 10 };
+			circle->radius = BENCH_RADIUS;
+			world.add(circle);
+			circles.push_back(circle);
+			startPositions.push_back(circle->position);
+			startVelocities.push_back(circle->velocity);
+		}
+	}
+
+	~BenchScene()
+	{
+		for (FizziksCircle* circle : circles) delete circle;
+	}
+
+	// Put everything back where it started, so every iteration does the same work
+	void reset()
+	{
+		for (int i = 0; i < circles.size(); i++)
+		{
+			circles[i]->position = startPositions[i];
+			circles[i]->velocity = startVelocities[i];
+			circles[i]->netForce = { 0,0 };
+		}
+	}
+
+	// Every pair of circles close enough to touch, found with the world's neighbour grid
+	std::vector<std::pair<FizziksCircle*, FizziksCircle*>> candidatePairs()
+	{
+		world.buildGrid();
+		const FizziksCircleGrid& grid = world.grid;
+
+		std::vector<std::pair<FizziksCircle*, FizziksCircle*>> pairs;
+		for (int i = 0; i < grid.size(); i++)
+		{
+			int begins[3];
+			int ends[3];
+			int rangeCount = grid.neighbourRanges(grid.x[i], grid.y[i], begins, ends);
+			for (int range = 0; range < rangeCount; range++)
+			{
+				for (int j = std::max(begins[range], i + 1); j < ends[range]; j++)
+				{
+					float dx = grid.x[j] - grid.x[i];
+					float dy = grid.y[j] - grid.y[i];
+					if (dx * dx + dy * dy < 4 * BENCH_RADIUS * BENCH_RADIUS) pairs.push_back({ grid.circles[i], grid.circles[j] });
+				}
+			}
+		}
+		return pairs;
+	}
+};
+
+// Adds the time/op and bytes/op columns, see the top of the file
+void ReportPerOp(benchmark::State& state, double opsPerIteration, double bytesPerOp)
+{
+	state.counters["time/op"] = benchmark::Counter(opsPerIteration, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+	state.counters["bytes/op"] = bytesPerOp;
+	state.SetItemsProcessed((int64_t)(state.iterations() * opsPerIteration));
+	state.SetBytesProcessed((int64_t)(state.iterations() * opsPerIteration * bytesPerOp));
+}
+
+// count x density
+void SceneArguments(benchmark::internal::Benchmark* benchmark)
+{
+	for (int count : { 1000, 10000, 100000 })
+	{
+		for (int density : { 5, 30, 60 })
+		{
+			benchmark->Args({ count, density });
+		}
+	}
+	benchmark->ArgNames({ "count", "density" });
+}
+
+///
+/// Collision Response
+///
+
+// One op = one candidate pair (touching or nearly touching) pushed apart
+void BM_CircleCircleCollisionResponse(benchmark::State& state)
+{
+	BenchScene scene((int)state.range(0), (int)state.range(1));
+	std::vector<std::pair<FizziksCircle*, FizziksCircle*>> pairs = scene.candidatePairs();
+
+	for (auto _ : state)
+	{
+		scene.reset();
+		int hits = 0;
+		for (const std::pair<FizziksCircle*, FizziksCircle*>& pair : pairs)
+		{
+			hits += CircleCircleCollisionResponse(pair.first, pair.second);
+		}
+		benchmark::DoNotOptimize(hits);
+	}
+
+	ReportPerOp(state, (double)pairs.size(), 2.0 * sizeof(FizziksCircle));
+}
+BENCHMARK(BM_CircleCircleCollisionResponse)->Apply(SceneArguments);
+
+// One op = one circle tested against the floor. Density moves more circles onto the floor as it packs them tighter
+void BM_CircleHalfspaceCollisionResponse(benchmark::State& state)
+{
+	BenchScene scene((int)state.range(0), (int)state.range(1));
+	float size = ArenaSize((int)state.range(0), (int)state.range(1));
+	// Slide the circles down so the bottom tenth of them sit in the floor
+	for (Vector2& position : scene.startPositions) position.y += size * 0.1f;
+
+	for (auto _ : state)
+	{
+		scene.reset();
+		int hits = 0;
+		for (FizziksCircle* circle : scene.circles)
+		{
+			hits += CircleHalfspaceCollisionResponse(circle, &scene.floor, &scene.world);
+		}
+		benchmark::DoNotOptimize(hits);
+	}
+
+	ReportPerOp(state, (double)scene.circles.size(), sizeof(FizziksCircle));
+}
+BENCHMARK(BM_CircleHalfspaceCollisionResponse)->Apply(SceneArguments);
+
+///
+/// Integration
+///
+
+// One op = one circle moved. The third argument is the FizziksIntegrator
+void BM_ApplyKinematics(benchmark::State& state)
+{
+	BenchScene scene((int)state.range(0), (int)state.range(1));
+	scene.world.integrator = (FizziksIntegrator)state.range(2);
+
+	for (auto _ : state)
+	{
+		scene.world.applyKinematics();
+		benchmark::ClobberMemory();
+	}
+
+	ReportPerOp(state, (double)scene.world.objekts.size(), sizeof(FizziksCircle));
+}
+BENCHMARK(BM_ApplyKinematics)->ArgsProduct({ { 1000, 10000, 100000 }, { 30 }, { EXPLICIT_EULER, SYMPLECTIC_EULER, VELOCITY_VERLET, POSITION_VERLET } })
+	->ArgNames({ "count", "density", "integrator" });
+
+///
+/// Whole Step
+///
+
+// One op = one circle through a full FizziksWorld::update (grid, forces, collisions, integration)
+void BM_WorldUpdate(benchmark::State& state)
+{
+	BenchScene scene((int)state.range(0), (int)state.range(1));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		scene.reset();
+		state.ResumeTiming();
+
+		scene.world.update();
+	}
+
+	ReportPerOp(state, (double)scene.circles.size(), sizeof(FizziksCircle));
+}
+BENCHMARK(BM_WorldUpdate)->Apply(SceneArguments)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+///
+/// raymath
+///
+
+// Vector2 operations over count vectors, the way the physics loops use them. Density only picks
+// how far apart the vectors are, which matters for Vector2Normalize's length
+void BM_Vector2Bulk(benchmark::State& state)
+{
+	int count = (int)state.range(0);
+	float size = ArenaSize(count, (int)state.range(1));
+
+	BenchRandom random;
+	std::vector<Vector2> positions(count);
+	std::vector<Vector2> velocities(count);
+	for (int i = 0; i < count; i++)
+	{
+		positions[i] = { random.next01() * size, random.next01() * size };
+		velocities[i] = { random.next01() * 20 - 10, random.next01() * 20 - 10 };
+	}
+	Vector2 centre = { size * 0.5f, size * 0.5f };
+
+	for (auto _ : state)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			Vector2 towardsCentre = Vector2Normalize(Vector2Subtract(centre, positions[i]));
+			velocities[i] = Vector2Add(velocities[i], Vector2Scale(towardsCentre, 0.02f));
+			positions[i] = Vector2Add(positions[i], Vector2Scale(velocities[i], 0.02f));
+		}
+		benchmark::ClobberMemory();
+	}
+
+	ReportPerOp(state, count, 2.0 * sizeof(Vector2));
+}
+BENCHMARK(BM_Vector2Bulk)->Apply(SceneArguments);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,135 @@
+/*
+Image format benchmark: how long raylib takes to convert pixel data between formats.
+
+No window or GL context is needed, everything timed runs on the CPU: ImageFormat() for every pair of
+uncompressed pixel formats, LoadImageColors() from every uncompressed format, and ImageMipmaps() /
+ImageMipmapsEx() on an image of every uncompressed format.
+
+Usage:
+	image_format_benchmark [--size N] [--runs N] [--from FORMAT]
+
+Every source image is N x N pixels (2048 by default) of random values, converted --runs times (5 by default).
+The minimum time of the runs is printed in ms, with the speed in millions of pixels per second. The time
+includes allocating the destination data, as ImageFormat() does, but not copying the source image.
+--from only times conversions from one format (its number in the PixelFormat enum).
+
+Most pairs of the 8-bit and 16-bit formats (GRAYSCALE to R8G8B8A8) have direct converters in rtextures.c (see
+GetPixelFormatJob()). The other pairs, and every pair with a float or half float format, go through
+LoadImageDataNormalized(), so they show what the generic path costs. Mipmaps are box filtered in place for the
+formats with 8-bit channels, the other formats go through an RGBA copy of the levels.
+*/
+
+#include "raylib.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static const char* FORMAT_NAMES[] = {
+	"", "GRAYSCALE", "GRAY_ALPHA", "R5G6B5", "R8G8B8", "R5G5B5A1", "R4G4B4A4", "R8G8B8A8",
+	"R32", "R32G32B32", "R32G32B32A32", "R16", "R16G16B16", "R16G16B16A16"
+};
+
+const int FIRST_FORMAT = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+const int LAST_FORMAT = PIXELFORMAT_UNCOMPRESSED_R16G16B16A16;
+
+// Random RGBA pixels converted to the format, so float and half float images hold values in [0, 1]
+static Image MakeSourceImage(int size, int format)
+{
+	Image image = GenImageColor(size, size, BLACK);
+	unsigned char* data = (unsigned char*)image.data;
+	unsigned int seed = 12345;
+	for (int i = 0; i < size * size * 4; i++)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		data[i] = (unsigned char)(seed >> 24);
+	}
+	ImageFormat(&image, format);
+	return image;
+}
+
+static double Milliseconds(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+	int size = 2048;
+	int runs = 5;
+	int from = 0;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) size = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) runs = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--from") == 0 && i + 1 < argc) from = atoi(argv[++i]);
+		else
+		{
+			printf("usage: %s [--size N] [--runs N] [--from FORMAT]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (size < 1) size = 1;
+	if (runs < 1) runs = 1;
+
+	// LoadImageColors() warns about every float image it narrows to 8 bit
+	SetTraceLogLevel(LOG_ERROR);
+
+	double megapixels = (double)size * size / 1000000.0;
+	printf("%dx%d pixels, best of %d runs\n", size, size, runs);
+	printf("%-14s %-14s %10s %10s\n", "from", "to", "ms", "Mpixel/s");
+
+	for (int srcFormat = FIRST_FORMAT; srcFormat <= LAST_FORMAT; srcFormat++)
+	{
+		if (from != 0 && srcFormat != from) continue;
+		Image source = MakeSourceImage(size, srcFormat);
+
+		for (int dstFormat = FIRST_FORMAT; dstFormat <= LAST_FORMAT; dstFormat++)
+		{
+			if (dstFormat == srcFormat) continue;
+
+			double best = 0;
+			for (int run = 0; run < runs; run++)
+			{
+				Image image = ImageCopy(source);
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				ImageFormat(&image, dstFormat);
+				double time = Milliseconds(start);
+				UnloadImage(image);
+				if (run == 0 || time < best) best = time;
+			}
+			printf("%-14s %-14s %10.3f %10.1f\n", FORMAT_NAMES[srcFormat], FORMAT_NAMES[dstFormat], best, megapixels / (best / 1000.0));
+		}
+
+		double best = 0;
+		for (int run = 0; run < runs; run++)
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			Color* colors = LoadImageColors(source);
+			double time = Milliseconds(start);
+			UnloadImageColors(colors);
+			if (run == 0 || time < best) best = time;
+		}
+		printf("%-14s %-14s %10.3f %10.1f\n", FORMAT_NAMES[srcFormat], "LoadImageColors", best, megapixels / (best / 1000.0));
+
+		// Plain average, then color channels averaged in linear light (sRGB)
+		for (int srgb = 0; srgb < 2; srgb++)
+		{
+			best = 0;
+			for (int run = 0; run < runs; run++)
+			{
+				Image image = ImageCopy(source);
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				ImageMipmapsEx(&image, srgb == 1);
+				double time = Milliseconds(start);
+				UnloadImage(image);
+				if (run == 0 || time < best) best = time;
+			}
+			printf("%-14s %-14s %10.3f %10.1f\n", FORMAT_NAMES[srcFormat], srgb ? "mipmaps sRGB" : "mipmaps", best, megapixels / (best / 1000.0));
+		}
+
+		UnloadImage(source);
+	}
+
+	return 0;
+}
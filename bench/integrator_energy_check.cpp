@@ -0,0 +1,154 @@
+/*
+Checks how much energy each integrator (FizziksIntegrator) gains or loses on an orbit.
+
+No window or GPU is needed, only the fizziks library.
+
+Usage:
+	integrator_energy_check [--orbits N]
+
+The scene is one circle orbiting a RADIAL_FIELD with no radius, so the pull is the same strength at any
+distance. There is no gravity and nothing to collide with. Energy is kinetic plus the field's potential:
+	E = 1/2 m v^2 + m * strength * distance
+The circle starts on a circular orbit and runs --orbits orbits (10 by default) under every integrator.
+The drift of a run is the largest |E - E0| / E0 seen so far. One more run switches between the three symplectic
+integrators every SWITCH_STEPS steps, the way pressing I in the game does.
+
+Then every run is repeated with a pendulum hanging far away from the orbit. Its pin constraint makes the world
+take XPBD substeps (FizziksWorld::solveConstraints), which predict each substep with the world's integrator.
+Forces are only worked out once per step, so during the substeps the field keeps pulling towards where the centre
+was at the start of the step. That pushes the circle forwards and every integrator gains energy, but Explicit Euler
+still gains the most.
+
+Exits with 1 unless:
+	- Explicit Euler gains more than 10%, and its drift over the whole run is more than 1.5 times its drift over the
+	  first half (it keeps growing).
+	- Symplectic Euler, Velocity Verlet and Position Verlet stay under 2%, and their drift over the whole run
+	  is at most 1.5 times their drift over the first half. So does the switching run.
+	- With the pendulum, every run ends at least 5% (of E0) below Explicit Euler.
+*/
+
+#include "fizziks.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+const Vector2 CENTRE = { 800, 450 };
+const float ORBIT_RADIUS = 200; // in px
+const float PULL = 500; // in px/s^2
+const int SWITCH_STEPS = 50; // Steps between integrator changes in the switching run
+
+struct EnergyRun
+{
+	float halfDrift = 0; // Largest relative energy error over the first half of the run
+	float drift = 0; // Largest relative energy error over the whole run
+	float finalChange = 0; // (E - E0) / E0 at the end, positive when energy was gained
+};
+
+static float Energy(const FizziksCircle& circle)
+{
+	float speed = Vector2Length(circle.velocity);
+	return 0.5f * circle.mass * speed * speed + circle.mass * PULL * Vector2Distance(circle.position, CENTRE);
+}
+
+// switching: cycle through SYMPLECTIC_EULER, VELOCITY_VERLET and POSITION_VERLET instead of keeping integrator
+// pinned: also tie the circle to the centre with a pin constraint, so the world takes XPBD substeps
+static EnergyRun Run(FizziksIntegrator integrator, bool switching, bool pinned, int stepCount)
+{
+	FizziksWorld world;
+	world.integrator = integrator;
+	world.accelerationGravity = { 0, 0 };
+
+	FizziksForceField field;
+	field.type = RADIAL_FIELD;
+	field.position = CENTRE;
+	field.strength = PULL;
+	world.forceFields.push_back(field);
+
+	// Circular orbit: v^2 / r = pull
+	FizziksCircle circle;
+	circle.radius = 10;
+	circle.position = { CENTRE.x + ORBIT_RADIUS, CENTRE.y };
+	circle.velocity = { 0, sqrtf(PULL * ORBIT_RADIUS) };
+	world.add(&circle);
+
+	// A pendulum far away from the orbit. The circle never touches it, but one constraint makes the whole world take XPBD substeps
+	FizziksCircle bob;
+	if (pinned)
+	{
+		bob.radius = 10;
+		bob.position = { CENTRE.x + 20 * ORBIT_RADIUS, CENTRE.y };
+		world.add(&bob);
+
+		FizziksPinConstraint* pin = new FizziksPinConstraint();
+		pin->objekt = &bob;
+		pin->anchor = { bob.position.x, bob.position.y - ORBIT_RADIUS };
+		pin->length = ORBIT_RADIUS;
+		world.addConstraint(pin);
+	}
+
+	float startEnergy = Energy(circle);
+	EnergyRun run;
+	for (int step = 0; step < stepCount; step++)
+	{
+		if (switching) world.integrator = (FizziksIntegrator)(SYMPLECTIC_EULER + (step / SWITCH_STEPS) % 3);
+		world.update();
+
+		float change = (Energy(circle) - startEnergy) / startEnergy;
+		run.drift = fmaxf(run.drift, fabsf(change));
+		if (step < stepCount / 2) run.halfDrift = run.drift;
+		run.finalChange = change;
+	}
+
+	world.removeConstraintsOf(&bob);
+	return run;
+}
+
+int main(int argc, char** argv)
+{
+	int orbitCount = 10;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--orbits") == 0 && i + 1 < argc) orbitCount = atoi(argv[++i]);
+		else
+		{
+			printf("usage: %s [--orbits N]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (orbitCount < 2) orbitCount = 2;
+
+	// One orbit is 2*pi*r / v seconds
+	float dt = FizziksWorld().dt;
+	float period = 2 * PI * ORBIT_RADIUS / sqrtf(PULL * ORBIT_RADIUS);
+	int stepCount = (int)(orbitCount * period / dt);
+
+	printf("%d orbits, %d steps of %.4f s\n", orbitCount, stepCount, dt);
+
+	bool passed = true;
+	float explicitChange = 0; // Final change of Explicit Euler in the scene being run, the others are compared to it
+	for (int scene = 0; scene < 2 * (POSITION_VERLET + 2); scene++)
+	{
+		int integrator = scene % (POSITION_VERLET + 2);
+		bool pinned = scene > POSITION_VERLET + 1;
+		bool switching = integrator > POSITION_VERLET;
+		if (integrator == EXPLICIT_EULER) printf("\n%-18s %12s %12s %12s\n", pinned ? "orbit + pendulum" : "orbit", "half drift", "drift", "final");
+
+		EnergyRun run = Run(switching ? SYMPLECTIC_EULER : (FizziksIntegrator)integrator, switching, pinned, stepCount);
+
+		bool ok;
+		if (integrator == EXPLICIT_EULER)
+		{
+			explicitChange = run.finalChange;
+			ok = run.finalChange > 0.1f && (pinned || run.drift > 1.5f * run.halfDrift);
+		}
+		else if (pinned) ok = run.finalChange < explicitChange - 0.05f;
+		else ok = run.drift < 0.02f && run.drift <= 1.5f * run.halfDrift;
+		passed = passed && ok;
+
+		printf("%-18s %11.4f%% %11.4f%% %11.4f%%  %s\n", switching ? "Switching" : FizziksIntegratorName((FizziksIntegrator)integrator),
+			run.halfDrift * 100, run.drift * 100, run.finalChange * 100, ok ? "ok" : "FAILED");
+	}
+
+	return passed ? 0 : 1;
+}
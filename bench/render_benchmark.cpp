@@ -0,0 +1,337 @@
+/*
+Headless rendering benchmark: how much CPU time raylib spends building a frame of the game's drawing.
+
+No window is opened. rlgl is started with a "null" OpenGL, where every GL function does nothing, so
+what gets timed is exactly the CPU side: DrawCircle/DrawLineEx tessellating in rshapes, rlVertex2f and
+rlColor4ub filling the render batch, raymath, and rlgl's batch bookkeeping. That is the code LTO and
+PGO can speed up, and it is why this program is the PGO training run (see CMakePresets.json).
+
+Usage:
+	render_benchmark [--circles N] [--frames N] [--warmup N] [--buffers N] [--persistent] [--labels] [--sorted] [--sdf-lines] [--window]
+
+Prints the per-frame CPU time (mean, median, min, max) for a scene like the game's: every circle is
+drawn with DrawCircle plus its velocity line with DrawLineEx, as DrawFizziksObjekt does. The rlgl
+batch counters (rlGetBatchStats) show how many flushes and draw calls a frame took, what caused the
+flushes, and how many bytes went to the GPU.
+
+--labels also draws a textured quad on every circle, standing in for the game's name labels (DrawText
+uses the font texture, so the batch switches texture twice per circle). --sorted draws the scene in
+sorted mode (BeginSortedMode), which groups the draws by texture and shape type. --sdf-lines queues
+the velocity lines in the game's LineRenderer (line_renderer.h) instead of DrawLineEx, so they leave
+the batch and go out as one instanced draw call (not counted in the batch stats).
+
+--buffers N draws with an rlgl render batch of N vertex buffers instead of the default batch. With
+more than one buffer and GL_ARB_buffer_storage, rlgl streams the vertices through persistent mapped
+buffers. The null GL only reports that extension with --persistent.
+
+The null GL never makes the CPU wait for a GPU, so it cannot show upload stalls. --window opens a real
+window and draws with the real driver (no vsync), timing whole frames including EndDrawing's buffer
+swap. That is the run to compare --buffers 1 with --buffers 3 for heavy scenes.
+
+The null GL functions are called through the real GL function pointer types. That is fine on x64 and
+ARM64, but 32 bit Windows GL uses __stdcall, so this benchmark is not supported on Win32.
+*/
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "raymath.h"
+#include "line_renderer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+///
+/// Null OpenGL
+///
+
+const int GL_FALSE_VALUE = 0;
+const int GL_TRUE_VALUE = 1;
+
+// Everything that returns something gets 1: a valid looking id/location, or "true"
+static intptr_t NullGlFunction()
+{
+	return 1;
+}
+
+static const unsigned char* NullGlGetString(unsigned int name)
+{
+	(void)name;
+	return (const unsigned char*)"4.3.0 Null";
+}
+
+static bool nullGlPersistentMapping = false;
+
+static const unsigned char* NullGlGetStringi(unsigned int name, unsigned int index)
+{
+	(void)name;
+	(void)index;
+	return (const unsigned char*)(nullGlPersistentMapping ? "GL_ARB_buffer_storage" : "GL_null_extension");
+}
+
+// Every limit/count is 0 (no compressed formats...), except one made up extension: glad gives up with none
+static void NullGlGetIntegerv(unsigned int name, int* data)
+{
+	*data = (name == 0x821D /* GL_NUM_EXTENSIONS */) ? 1 : 0;
+}
+
+static void NullGlGetFloatv(unsigned int name, float* data)
+{
+	(void)name;
+	*data = 0;
+}
+
+// glGenTextures, glGenBuffers... hand out ids 1, 2, 3..., 0 would mean "failed"
+static unsigned int nullGlLastId = 0;
+
+static void NullGlGenObjects(int count, unsigned int* ids)
+{
+	for (int i = 0; i < count; i++) ids[i] = ++nullGlLastId;
+}
+
+// glCreateShader, glCreateProgram: same ids as above, so a loaded shader never looks like the default one
+static unsigned int NullGlCreateObject()
+{
+	return ++nullGlLastId;
+}
+
+// Mapped buffers get real memory, so rlgl can write vertices into them. Kept until the program exits
+static std::vector<std::vector<unsigned char>> nullGlMappedBuffers;
+
+static void* NullGlMapBufferRange(unsigned int target, intptr_t offset, intptr_t length, unsigned int access)
+{
+	(void)target;
+	(void)offset;
+	(void)access;
+	nullGlMappedBuffers.emplace_back((size_t)length);
+	return nullGlMappedBuffers.back().data();
+}
+
+// Fences are always signaled, there is no GPU to wait for
+static unsigned int NullGlClientWaitSync(void* sync, unsigned int flags, uint64_t timeout)
+{
+	(void)sync;
+	(void)flags;
+	(void)timeout;
+	return 0x911A; // GL_ALREADY_SIGNALED
+}
+
+// Shaders always compile and link
+static void NullGlGetShaderOrProgramiv(unsigned int id, unsigned int name, int* data)
+{
+	(void)id;
+	*data = (name == 0x8B81 /* GL_COMPILE_STATUS */ || name == 0x8B82 /* GL_LINK_STATUS */) ? GL_TRUE_VALUE : GL_FALSE_VALUE;
+}
+
+static void* NullGlLoader(const char* name)
+{
+	if (strcmp(name, "glGetString") == 0) return (void*)NullGlGetString;
+	if (strcmp(name, "glGetStringi") == 0) return (void*)NullGlGetStringi;
+	if (strcmp(name, "glGetIntegerv") == 0) return (void*)NullGlGetIntegerv;
+	if (strcmp(name, "glGetFloatv") == 0) return (void*)NullGlGetFloatv;
+	if (strncmp(name, "glGen", 5) == 0 && strcmp(name, "glGenerateMipmap") != 0) return (void*)NullGlGenObjects;
+	if (strcmp(name, "glGetShaderiv") == 0 || strcmp(name, "glGetProgramiv") == 0) return (void*)NullGlGetShaderOrProgramiv;
+	if (strcmp(name, "glCreateShader") == 0 || strcmp(name, "glCreateProgram") == 0) return (void*)NullGlCreateObject;
+	if (strcmp(name, "glMapBufferRange") == 0) return (void*)NullGlMapBufferRange;
+	if (strcmp(name, "glClientWaitSync") == 0) return (void*)NullGlClientWaitSync;
+	return (void*)NullGlFunction;
+}
+
+///
+/// Scene
+///
+
+const int SCREEN_WIDTH = 1600;
+const int SCREEN_HEIGHT = 900;
+
+struct RenderCircle
+{
+	Vector2 position;
+	Vector2 velocity;
+	float radius;
+	Color color;
+};
+
+std::vector<RenderCircle> MakeCircles(int count)
+{
+	std::vector<RenderCircle> circles(count);
+	srand(12345); // Same scene every run
+	for (RenderCircle& circle : circles)
+	{
+		circle.position = { (float)(rand() % SCREEN_WIDTH), (float)(rand() % SCREEN_HEIGHT) };
+		circle.velocity = { (float)(rand() % 200 - 100), (float)(rand() % 200 - 100) };
+		circle.radius = (float)(rand() % 26 + 5); // Same range as the birds the game launches
+		circle.color = { (unsigned char)(rand() % 256), (unsigned char)(rand() % 256), (unsigned char)(rand() % 256), 255 };
+	}
+	return circles;
+}
+
+struct RenderOptions
+{
+	bool window = false;
+	bool sorted = false;
+	Texture2D label = {}; // id 0 = no labels
+	LineRenderer* lines = nullptr; // nullptr = velocity lines with DrawLineEx
+};
+
+// Moves the circles a little so frames are not identical, then draws them the way the game does
+void DrawCircles(std::vector<RenderCircle>& circles, float dt, const RenderOptions& options)
+{
+	for (RenderCircle& circle : circles)
+	{
+		circle.position = Vector2Add(circle.position, Vector2Scale(circle.velocity, dt));
+		if (circle.position.x < 0 || circle.position.x > SCREEN_WIDTH) circle.velocity.x *= -1;
+		if (circle.position.y < 0 || circle.position.y > SCREEN_HEIGHT) circle.velocity.y *= -1;
+	}
+
+	for (const RenderCircle& circle : circles)
+	{
+		DrawCircle((int)circle.position.x, (int)circle.position.y, circle.radius, circle.color);
+		if (options.label.id != 0) DrawTexture(options.label, (int)circle.position.x, (int)circle.position.y, LIGHTGRAY);
+		Vector2 end = Vector2Add(circle.position, circle.velocity);
+		if (options.lines != nullptr) options.lines->add(circle.position, end, 1, circle.color);
+		else DrawLineEx(circle.position, end, 1, circle.color);
+	}
+}
+
+void DrawFrame(std::vector<RenderCircle>& circles, float dt, const RenderOptions& options)
+{
+	if (options.window)
+	{
+		BeginDrawing();
+		ClearBackground(RAYWHITE);
+	}
+	else rlClearScreenBuffers();
+
+	if (options.sorted) BeginSortedMode();
+	DrawCircles(circles, dt, options);
+	if (options.sorted) EndSortedMode();
+	if (options.lines != nullptr) options.lines->draw();
+
+	if (options.window) EndDrawing();
+	else
+	{
+		rlDrawRenderBatchActive(); // What EndDrawing does before swapping buffers
+		rlUpdateRenderBatchLimits();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int circleCount = 10000;
+	int frameCount = 300;
+	int warmupCount = 20;
+	int bufferCount = 0; // 0 = raylib's default batch
+	bool window = false;
+	bool labels = false;
+	bool sorted = false;
+	bool sdfLines = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--window") == 0) window = true;
+		else if (strcmp(argv[i], "--labels") == 0) labels = true;
+		else if (strcmp(argv[i], "--sorted") == 0) sorted = true;
+		else if (strcmp(argv[i], "--sdf-lines") == 0) sdfLines = true;
+		else if (strcmp(argv[i], "--persistent") == 0) nullGlPersistentMapping = true;
+		else if (strcmp(argv[i], "--circles") == 0 && i + 1 < argc) circleCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frameCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) warmupCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--buffers") == 0 && i + 1 < argc) bufferCount = atoi(argv[++i]);
+		else
+		{
+			printf("usage: %s [--circles N] [--frames N] [--warmup N] [--buffers N] [--persistent] [--labels] [--sorted] [--sdf-lines] [--window]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (frameCount < 1) frameCount = 1;
+
+	SetTraceLogLevel(LOG_WARNING);
+	if (window)
+	{
+		InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "render_benchmark");
+	}
+	else
+	{
+		rlLoadExtensions((void*)NullGlLoader);
+		rlglInit(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+		// Same 2D projection InitWindow sets up
+		rlMatrixMode(RL_PROJECTION);
+		rlLoadIdentity();
+		rlOrtho(0, SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0, 1);
+		rlMatrixMode(RL_MODELVIEW);
+		rlLoadIdentity();
+	}
+
+	rlRenderBatch batch = { 0 };
+	if (bufferCount > 0)
+	{
+		batch = rlLoadRenderBatch(bufferCount, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+		rlSetRenderBatchActive(&batch);
+	}
+
+	RenderOptions options;
+	options.window = window;
+	options.sorted = sorted;
+	if (labels)
+	{
+		Image labelImage = GenImageColor(24, 8, WHITE);
+		options.label = LoadTextureFromImage(labelImage);
+		UnloadImage(labelImage);
+	}
+	LineRenderer lineRenderer;
+	if (sdfLines)
+	{
+		lineRenderer.load();
+		options.lines = &lineRenderer;
+	}
+
+	std::vector<RenderCircle> circles = MakeCircles(circleCount);
+	const float dt = 1.0f / 50;
+
+	for (int frame = 0; frame < warmupCount; frame++) DrawFrame(circles, dt, options);
+	rlResetBatchStats();
+
+	std::vector<double> frameMilliseconds(frameCount);
+	for (int frame = 0; frame < frameCount; frame++)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		DrawFrame(circles, dt, options);
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+		frameMilliseconds[frame] = std::chrono::duration<double, std::milli>(end - start).count();
+	}
+
+	rlBatchStats batchStats = rlGetBatchStats();
+	if (options.label.id != 0) UnloadTexture(options.label);
+	lineRenderer.unload();
+	bool persistentMapped = (bufferCount > 0) && batch.vertexBuffer[0].persistentMapped;
+	if (bufferCount > 0)
+	{
+		rlSetRenderBatchActive(NULL);
+		rlUnloadRenderBatch(batch);
+	}
+	if (window) CloseWindow();
+	else rlglClose();
+
+	double total = 0;
+	for (double milliseconds : frameMilliseconds) total += milliseconds;
+	std::sort(frameMilliseconds.begin(), frameMilliseconds.end());
+
+	printf("circles: %d%s, frames: %d, %s GL, %s, %s lines, ", circleCount, labels ? " with labels" : "", frameCount,
+		window ? "real" : "null", sorted ? "sorted" : "call order", sdfLines ? "SDF" : "DrawLineEx");
+	if (bufferCount > 0) printf("%d batch buffers%s\n", bufferCount, persistentMapped ? " (persistent mapped)" : "");
+	else printf("default batch\n");
+	printf("frame CPU time (ms): mean %.3f  median %.3f  min %.3f  max %.3f\n",
+		total / frameCount, frameMilliseconds[frameCount / 2], frameMilliseconds.front(), frameMilliseconds.back());
+	printf("per frame: %u flushes, %u draw calls, %u vertices, %u indices, %u KB uploaded\n",
+		batchStats.flushCount / frameCount, batchStats.drawCallCount / frameCount, batchStats.vertexCount / frameCount,
+		batchStats.indexCount / frameCount, batchStats.byteCount / frameCount / 1024);
+	printf("waits for the GPU to release a mapped buffer: %u\n", batchStats.syncWaitCount);
+	printf("flushes per frame by reason: vertex limit %u, draw call limit %u, texture %u, matrix %u, state %u, explicit %u\n",
+		batchStats.flushVertexLimit / frameCount, batchStats.flushDrawCallLimit / frameCount, batchStats.flushTexture / frameCount,
+		batchStats.flushMatrix / frameCount, batchStats.flushState / frameCount, batchStats.flushExplicit / frameCount);
+	return 0;
+}
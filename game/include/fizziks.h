@@ -0,0 +1,505 @@
+#pragma once
+
+/*
+Fizziks: the physics simulation. Objekts, constraints, fluid, force fields, mutual gravity and collisions.
+
+It uses raylib's Vector2 and Color types and raymath.h, which are all header-only, but never draws or
+opens a window. That way it builds as a library that the game, tools and benchmarks can all link against.
+Anything the game may want to see for debugging is recorded in FizziksWorld::debugLines instead of drawn.
+*/
+
+#include "raylib.h"
+#include "raymath.h"
+#include "fizziks_simd.h"
+#include "fizziks_threads.h"
+#include <string>
+#include <vector>
+
+/// 
+/// FrizziksObjekts Declarions
+/// 
+
+enum FizziksShape
+{
+	CIRCLE,
+	HALF_SPACE
+};
+
+// How FizziksWorld::applyKinematics turns forces into motion each step (and solveConstraints each substep).
+// Explicit Euler moves objects with the velocity from BEFORE the force was applied, which adds
+// energy every step and blows up with big dt. The other three are symplectic: their energy error
+// stays bounded instead of growing, so we can take bigger steps for the same quality.
+enum FizziksIntegrator
+{
+	EXPLICIT_EULER,		// x += v*dt, then v += a*dt (the original method, kept for comparison)
+	SYMPLECTIC_EULER,	// v += a*dt, then x += v*dt (uses the NEW velocity to move)
+	VELOCITY_VERLET,	// x += v*dt + 0.5*a*dt^2, velocity uses the average of old and new acceleration
+	POSITION_VERLET		// x_next = 2x - x_previous + a*dt^2, velocity is worked out from the change in position
+};
+
+const char* FizziksIntegratorName(FizziksIntegrator integrator);
+
+class FizziksObjekt
+{
+public:
+	bool isStatic = false; // if this is set to true, don't move object according to velocity or gravity
+	Vector2 position = { 0,0 }; // In px
+	Vector2 velocity = { 0,0 }; // in px/s
+	float mass = 1; // in kg
+	Vector2 netForce = { 0,0 }; // in N
+	float grippiness = 0.1f;
+
+	// Integrator memory, only some integrators use these (see FizziksIntegrator)
+	Vector2 acceleration = { 0,0 }; // in px/s^2, acceleration used on the last step (Velocity Verlet)
+	Vector2 previousPosition = { 0,0 }; // in px, position before the last step (Position Verlet)
+
+	std::string name = "objekt";		
+	Color color = RED;
+
+	virtual FizziksShape Shape() = 0; // This is a pure virtual, or "abstract" function. 
+	//It is a declaration that has no definition itself, but must be defined in child classes.
+};
+
+class FizziksCircle : public FizziksObjekt
+{
+public:
+	float radius; // circle radius in pixels
+	bool isFluid = false; // Fluid circles are pushed around by SPH pressure instead of bumping into each other
+
+	FizziksShape Shape() override
+	{
+		return CIRCLE;
+	}
+};
+
+class FizziksHalfspace : public FizziksObjekt
+{
+private:
+	//FizziksObjekt::position in this context represents an arbitrary point that lies on the line.
+	float rotation = 0;
+	Vector2 normal = {0, -1}; // normal vector represents the direction perpendicular to the surface, pointing away from it.
+	//We always keep normal vectors at a magnitude of 1, so they denote orrientation, but no magnitude
+
+public:
+	void setRotationDegrees(float rotationInDegrees)
+	{
+		rotation = rotationInDegrees;
+		normal = Vector2Rotate({ 0, -1 }, rotation * DEG2RAD);
+	}
+
+	float getRotation()
+	{
+		return rotation;
+	}
+
+	Vector2 getNormal()
+	{
+		return normal;
+	}
+
+	FizziksShape Shape() override
+	{
+		return HALF_SPACE;
+	}
+};
+
+/// 
+/// Constraints
+/// 
+/// Constraints are rules that tie objects together, like "these two circles stay 20px apart".
+/// They are solved with XPBD (Extended Position Based Dynamics): instead of working out forces,
+/// we directly move the objects until the rule is true again, and the velocity is whatever
+/// that movement works out to be. Chains, ropes and bridges are just lots of distance constraints.
+///
+
+// How much an objekt moves when pushed, 1/mass. Static objekts are infinitely heavy so they don't move at all
+float InverseMass(FizziksObjekt* objekt);
+
+enum FizziksConstraintType
+{
+	DISTANCE_CONSTRAINT,
+	PIN_CONSTRAINT,
+	HINGE_CONSTRAINT
+};
+
+class FizziksConstraint
+{
+public:
+	// How soft the constraint is (the inverse of stiffness). 0 = perfectly rigid, bigger = springier
+	float compliance = 0;
+
+	// Total correction applied so far this substep. XPBD needs it to make compliance independent of iteration count
+	float lambda = 0;
+
+	// Fills objektsOut with the objekts this constraint moves and returns how many (at most 3)
+	virtual int getObjekts(FizziksObjekt* objektsOut[3]) = 0;
+
+	// Move the objekts to satisfy the constraint. substepDt is the size of one substep in seconds
+	virtual void solve(float substepDt) = 0;
+
+	virtual FizziksConstraintType Type() = 0; // Which kind of constraint, like FizziksObjekt::Shape()
+
+	virtual ~FizziksConstraint() {}
+};
+
+// Keeps two objekts a fixed distance apart. With isRope, they may get closer (the rope goes slack) but never further
+class FizziksDistanceConstraint : public FizziksConstraint
+{
+public:
+	FizziksObjekt* a = nullptr;
+	FizziksObjekt* b = nullptr;
+	float restLength = 0; // in px
+	bool isRope = false;
+
+	int getObjekts(FizziksObjekt* objektsOut[3]) override
+	{
+		objektsOut[0] = a;
+		objektsOut[1] = b;
+		return 2;
+	}
+
+	void solve(float substepDt) override;
+
+	FizziksConstraintType Type() override
+	{
+		return DISTANCE_CONSTRAINT;
+	}
+
+};
+
+// Nails an objekt to a point in the world. With a length, it swings around the point like a pendulum
+class FizziksPinConstraint : public FizziksConstraint
+{
+public:
+	FizziksObjekt* objekt = nullptr;
+	Vector2 anchor = { 0,0 }; // in px
+	float length = 0; // in px, 0 = nailed exactly onto the anchor
+
+	int getObjekts(FizziksObjekt* objektsOut[3]) override
+	{
+		objektsOut[0] = objekt;
+		return 1;
+	}
+
+	void solve(float substepDt) override;
+
+	FizziksConstraintType Type() override
+	{
+		return PIN_CONSTRAINT;
+	}
+
+};
+
+// Limits the angle at the middle objekt (b) between the arms b->a and b->c, like a hinge that can only bend so far.
+// Use minAngle == maxAngle for a stiff joint, or a range for a hinge with stops. Angles are in radians, counterclockwise from b->a to b->c
+class FizziksHingeConstraint : public FizziksConstraint
+{
+public:
+	FizziksObjekt* a = nullptr;
+	FizziksObjekt* b = nullptr; // The hinge itself
+	FizziksObjekt* c = nullptr;
+	float minAngle = -PI;
+	float maxAngle = PI;
+
+	int getObjekts(FizziksObjekt* objektsOut[3]) override
+	{
+		objektsOut[0] = a;
+		objektsOut[1] = b;
+		objektsOut[2] = c;
+		return 3;
+	}
+
+	void solve(float substepDt) override;
+
+	FizziksConstraintType Type() override
+	{
+		return HINGE_CONSTRAINT;
+	}
+
+};
+
+/// 
+/// Neighbour Grid
+/// 
+/// Checking every circle against every other circle is n^2 checks, which is 10 billion for 100k circles.
+/// Instead we chop the world into square cells at least as big as the largest interaction distance,
+/// so anything a circle can touch is in its own cell or one of the 8 around it.
+///
+/// The cells are stored as a "cell-linked list" built with a counting sort: circles are copied into
+/// arrays sorted by cell, and cellStart[cell] says where each cell begins. Neighbouring cells in a row
+/// are next to each other in memory, so looping over them is fast and works well with SIMD.
+///
+
+class FizziksCircleGrid
+{
+public:
+	float cellSize = 1; // in px
+	Vector2 origin = { 0,0 }; // Top left corner of cell 0, in px
+	int columns = 0;
+	int rows = 0;
+	std::vector<int> cellStart; // circles of cell c are sorted indices cellStart[c] to cellStart[c + 1] - 1
+
+	// Circles sorted by cell, structure of arrays (SoA) so batch loops read only what they need.
+	// Positions and velocities are a snapshot from when the grid was built
+	std::vector<FizziksCircle*> circles;
+	std::vector<float> x, y; // in px
+	std::vector<float> vx, vy; // in px/s
+	std::vector<float> mass; // in kg
+	std::vector<float> fluidMass; // mass for fluid circles, 0 for everything else, so solids drop out of SPH sums
+	int fluidCount = 0;
+
+	int size() const
+	{
+		return (int)circles.size();
+	}
+
+	int cellColumn(float px) const
+	{
+		int column = (int)((px - origin.x) / cellSize);
+		return column < 0 ? 0 : (column >= columns ? columns - 1 : column);
+	}
+
+	int cellRow(float py) const
+	{
+		int row = (int)((py - origin.y) / cellSize);
+		return row < 0 ? 0 : (row >= rows ? rows - 1 : row);
+	}
+
+	// Sorted index ranges [begins[k], ends[k]) holding everything in the 3x3 cells around a point. Returns the number of ranges
+	int neighbourRanges(float px, float py, int begins[3], int ends[3]) const
+	{
+		int column = cellColumn(px);
+		int row = cellRow(py);
+		int firstColumn = column > 0 ? column - 1 : 0;
+		int lastColumn = column < columns - 1 ? column + 1 : column;
+
+		int rangeCount = 0;
+		for (int r = (row > 0 ? row - 1 : 0); r <= row + 1 && r < rows; r++)
+		{
+			begins[rangeCount] = cellStart[r * columns + firstColumn];
+			ends[rangeCount] = cellStart[r * columns + lastColumn + 1];
+			rangeCount++;
+		}
+		return rangeCount;
+	}
+
+	void build(const std::vector<FizziksObjekt*>& objekts, float minimumCellSize);
+};
+
+/// 
+/// Fluid
+/// 
+/// SPH (Smoothed Particle Hydrodynamics): every fluid circle is a blob of water. Its density is the mass of
+/// its neighbours, weighted by how close they are (the "kernel"). Squished water has high density and therefore
+/// high pressure, which pushes particles apart until the density is back to restDensity.
+/// Kernels are the 2D versions of the ones from Muller et al. 2003, "Particle-Based Fluid Simulation for Interactive Applications".
+///
+
+struct FizziksFluidSettings
+{
+	float smoothingRadius = 16; // in px, how far each particle can feel its neighbours (h)
+	float restDensity = 1.0f / 64.0f; // in kg/px^2, particle mass / (spacing between particles)^2
+	float stiffness = 50000; // in px^2/s^2, pressure = stiffness * (density - restDensity). This is the speed of sound squared
+	float viscosity = 500; // in px^2/s, how much neighbours drag each other to the same velocity (honey vs water)
+};
+
+/// 
+/// Force Fields
+/// 
+/// Forces that act on every circle inside an area: attractors and repulsors, whirlpools, drag and wind.
+/// Each field only visits the grid cells its area covers, so lots of small fields stay cheap.
+///
+
+enum FizziksForceFieldType
+{
+	RADIAL_FIELD,	// Pulls circles towards position (negative strength pushes them away)
+	VORTEX_FIELD,	// Swirls circles around position (positive strength spins clockwise on screen)
+	DRAG_FIELD,		// Slows circles down, like moving through water
+	WIND_FIELD		// Drag that pushes circles towards windVelocity instead of towards standing still
+};
+
+struct FizziksForceField
+{
+	FizziksForceFieldType type = RADIAL_FIELD;
+	Vector2 position = { 0,0 }; // Centre of the field, in px
+	float radius = 0; // in px. Circles further away are not affected. 0 = affects everything, everywhere
+
+	// RADIAL and VORTEX: acceleration at the centre in px/s^2, fading linearly to 0 at radius (unless radius is 0).
+	// It's an acceleration like gravity, so heavy and light circles are affected the same
+	float strength = 0;
+
+	// DRAG and WIND: Fdrag = -(linearDrag + quadraticDrag * |v|) * v, where v is the velocity relative to the air
+	float linearDrag = 0; // in kg/s
+	float quadraticDrag = 0; // in kg/px
+	Vector2 windVelocity = { 0,0 }; // in px/s, WIND only
+};
+
+/// 
+/// Mutual Gravity
+/// 
+/// Every circle pulls on every other circle: F = G * m1 * m2 / r^2. Doing every pair is n^2 again,
+/// so we use a Barnes-Hut quadtree: a clump of circles that is far enough away pulls like one big
+/// circle at the clump's centre of mass. "Far enough" is when clump size / distance < theta.
+/// theta = 0 is exact (and slow), 0.5 is a good trade, 1 is fast but sloppy.
+///
+
+struct FizziksMutualGravitySettings
+{
+	bool enabled = false;
+	float G = 1000; // Gravitational constant in px^3/(kg s^2). The real one is tiny, ours is picked to look good on screen
+	float theta = 0.5f; // Barnes-Hut opening angle, see above
+	float softening = 4; // in px, stops the force going to infinity when two circles are on top of each other
+};
+
+class FizziksQuadtree
+{
+public:
+	struct Node
+	{
+		float massX = 0, massY = 0; // Centre of mass of everything inside, in px
+		float mass = 0; // Total mass inside, in kg
+		float centreX = 0, centreY = 0, halfSize = 0; // The square this node covers, in px
+		int firstChild = -1; // The 4 children are nodes[firstChild] to nodes[firstChild + 3]. -1 = leaf
+		int begin = 0, end = 0; // Leaves only: the bodies inside are x[begin] to x[end - 1]
+	};
+
+	std::vector<Node> nodes; // nodes[0] is the root
+
+	// Bodies in tree order, so each leaf's bodies are next to each other
+	std::vector<int> gridSlot; // Grid slot of each body
+	std::vector<float> x, y, mass;
+
+	static const int leafSize = 8; // Most bodies in a leaf before it's split
+	static const int maxDepth = 24; // Stops splitting forever when bodies sit on exactly the same spot
+	static const int parallelDepth = 3; // The 4^3 = 64 subtrees below this depth are built on different threads
+
+	void build(const FizziksCircleGrid& grid, FizziksThreadPool& threads);
+
+	// Acceleration at (px, py) caused by every body in the tree
+	Vector2 acceleration(float px, float py, const FizziksMutualGravitySettings& settings) const;
+
+private:
+	static void sumChildren(Node& node, const Node* allNodes);
+
+	// Fills in subtree[nodeIndex], which covers bodies gridSlot[begin] to gridSlot[end - 1], splitting it if there are too many
+	void buildNode(const FizziksCircleGrid& grid, std::vector<Node>& subtree, int nodeIndex, int begin, int end, int depth);
+};
+
+/// 
+/// World
+/// 
+/// 
+
+// A line the physics wants drawn for debugging (forces, normals...). The game draws these after update()
+struct FizziksDebugLine
+{
+	Vector2 start;
+	Vector2 end;
+	float thickness;
+	Color color;
+};
+
+class FizziksWorld
+{
+private:
+	unsigned int objektCount = 0;
+public: 
+	std::vector<FizziksObjekt*> objekts; // All objects in physics simulation
+	
+	Vector2 accelerationGravity = {0, 10};
+
+	float dt = 1.0f / 50; // seconds/step, set this before calling update()
+
+	FizziksIntegrator integrator = SYMPLECTIC_EULER; // How applyKinematics moves objects, and how solveConstraints predicts each substep
+
+	std::vector<FizziksConstraint*> constraints; // All constraints between objects, owned by the world
+	int substeps = 8; // When there are constraints, each step is split into this many smaller XPBD steps
+	int constraintIterations = 1; // Times each constraint is solved per substep. More substeps beat more iterations
+
+	FizziksThreadPool threads; // Worker threads for the big loops
+
+	FizziksCircleGrid grid; // Circles sorted into cells, rebuilt at the start of every update
+	FizziksFluidSettings fluid; // Used by circles with isFluid
+
+	std::vector<FizziksForceField> forceFields;
+
+	FizziksMutualGravitySettings mutualGravity; // Circles attracting each other, for orbits
+	FizziksQuadtree quadtree; // Rebuilt every update while mutualGravity is enabled
+
+	bool recordDebugLines = true; // Turn off for big scenes, nobody can read 100k force arrows anyway
+	std::vector<FizziksDebugLine> debugLines; // Cleared at the start of every update
+
+	void addDebugLine(Vector2 start, Vector2 end, float thickness, Color color)
+	{
+		if (recordDebugLines) debugLines.push_back({ start, end, thickness, color });
+	}
+
+private:
+	// Constraints sorted into groups ("colours") where no two constraints share an objekt,
+	// so every constraint in a colour can be solved at the same time on different threads
+	std::vector<std::vector<FizziksConstraint*>> constraintColours;
+	std::vector<FizziksConstraint*> uncolouredConstraints; // Ran out of colours, solved one at a time
+	bool constraintColoursDirty = false;
+
+	// SPH scratch, one entry per grid slot
+	std::vector<float> fluidDensity;
+	std::vector<float> fluidInverseDensity;
+	std::vector<float> fluidPressureTerm; // pressure / density^2
+
+	// Where each objekt was predicted to be this substep, one entry per objekt. The constraint corrections are the difference
+	std::vector<Vector2> predictedPositions;
+
+	// Force field totals, one entry per grid slot, added to netForce once all fields are done
+	std::vector<float> fieldForceX;
+	std::vector<float> fieldForceY;
+
+public:
+
+	void add(FizziksObjekt* newObject); // Add to physics simulation
+
+	void addConstraint(FizziksConstraint* newConstraint); // Add to physics simulation, the world deletes it when it's removed
+
+	// Delete every constraint attached to objekt. Call this before deleting an objekt so no constraint points at freed memory
+	void removeConstraintsOf(FizziksObjekt* objekt);
+
+	void resetNetForces();
+
+	void addGravityForce();
+
+	void applyKinematics();
+
+	// Update state of all physics objects
+	void update();
+
+	// Greedy graph colouring: give each constraint the first colour none of its objekts are already using
+	void colourConstraints();
+
+	// XPBD substep loop. Forces (gravity, normal force, friction) were already added to netForce this frame
+	void solveConstraints();
+
+	// Pushes overlapping circles apart as position constraints, no forces. Run after the constraints in every substep
+	void solveCircleContacts();
+
+	void buildGrid();
+
+	void addMutualGravityForce();
+
+	// Adds one field's force to grid slots [begin, end), four circles at a time
+	void applyForceField(const FizziksForceField& field, int begin, int end);
+
+	void addForceFieldForces();
+
+	void addFluidForces();
+
+	void checkCollisions();
+};
+
+/// 
+/// Collision Response Functions
+/// 
+
+bool CircleCircleOverlap(FizziksCircle* circleA, FizziksCircle* circleB); // returns true if circles are overlapping
+bool CircleCircleCollisionResponse(FizziksCircle* circleA, FizziksCircle* circleB); // pushes overlapping circles apart, returns true if they were overlapping
+bool CircleCirclePushOut(FizziksCircle* circleA, FizziksCircle* circleB); // pushes overlapping circles apart by inverse mass, returns true if overlapping
+bool CircleHalfspaceCollisionResponse(FizziksCircle* circle, FizziksHalfspace* halfspace, FizziksWorld* world); // pushes the circle out and adds normal force and friction, returns true if overlapping
+bool CircleHalfspacePushOut(FizziksCircle* circle, FizziksHalfspace* halfspace); // only pushes the circle out, returns true if overlapping
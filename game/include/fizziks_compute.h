@@ -0,0 +1,160 @@
+#pragma once
+
+/*
+Runs the circle physics of a FizziksWorld on the GPU with compute shaders (OpenGL 4.3 through rlgl).
+
+Usage:
+	FizziksComputeSolver gpu;
+	gpu.load();                          // after the GL context exists (InitWindow). false = no compute shaders
+	if (gpu.canSimulate(world))
+	{
+		gpu.upload(world);               // circles and halfspaces into GPU buffers (SSBOs)
+		gpu.step(world.dt);              // as many steps as you like, nothing comes back to the CPU
+		gpu.download(world);             // read the circles back, or...
+		gpu.drawCircles();               // ...draw them straight from the GPU buffer
+	}
+	gpu.unload();                        // before CloseWindow
+
+Each step does what FizziksWorld::update does for a world of plain circles and halfspaces: gravity, halfspace
+push out with normal force and friction, circles pushing each other apart, then Euler integration. The GPU runs
+one thread per circle, so the order is a little different from checkCollisions:
+	1. clear  : empty every grid cell
+	2. bin    : every circle adds itself to its cell. Cells have a fixed number of slots (grid.cellCapacity,
+	            twice the fullest cell at upload). Circles that don't fit are counted in overflowCount(), and
+	            the other circles can't see them this step
+	3. step   : every circle reads the OLD positions of the circles in the 3x3 cells around it, moves half the
+	            overlap away from each one it touches, and integrates. The result goes to the other body buffer
+CPU checkCollisions moves circles one pair at a time, so later pairs see earlier pushes. Here every circle only
+sees where the others were at the start of the step (Jacobi instead of Gauss-Seidel), which is what lets every
+circle run at the same time. Piles settle a little slower.
+
+stepReference() is the same algorithm in plain C++ on the same grid, to check the shaders against
+(bench/compute_physics_check.cpp does that on Mesa's llvmpipe, no GPU needed).
+
+Not supported on the GPU: fluid, constraints, force fields, mutual gravity and the Verlet integrators.
+canSimulate() says no to worlds using them, and debug lines are not recorded.
+*/
+
+#include "fizziks.h"
+#include <vector>
+
+// One circle as the shaders see it (std430 layout, 32 bytes)
+struct FizziksComputeBody
+{
+	Vector2 position; // in px
+	Vector2 velocity; // in px/s
+	float radius; // in px
+	unsigned int flags; // FIZZIKS_COMPUTE_STATIC, FIZZIKS_COMPUTE_TOUCHING
+	Color color; // GREEN or RED after a step, like checkCollisions paints them
+	float grippiness;
+};
+
+// One halfspace as the shaders see it (std430 layout, 32 bytes)
+struct FizziksComputeHalfspace
+{
+	Vector2 point; // Any point on the surface, in px
+	Vector2 normal;
+	float grippiness;
+	unsigned int touched; // Set by a step when any circle touched it
+	float padding[2];
+};
+
+const unsigned int FIZZIKS_COMPUTE_STATIC = 1; // Collides but never moves on its own
+const unsigned int FIZZIKS_COMPUTE_TOUCHING = 2; // Touched a circle or halfspace on the last step
+
+// Fixed size grid the bodies are binned into, worked out from the bodies on every upload
+struct FizziksComputeGrid
+{
+	Vector2 origin = { 0,0 }; // Top left corner of cell 0, in px
+	float cellSize = 1; // in px, at least the largest diameter
+	int columns = 1;
+	int rows = 1;
+	int cellCapacity = 8; // Most circles one cell can hold
+
+	int cellCount() const
+	{
+		return columns * rows;
+	}
+
+	// Same clamping as FizziksCircleGrid: circles off the edge go in the edge cells
+	int cellOf(Vector2 position) const
+	{
+		int column = (int)((position.x - origin.x) / cellSize);
+		int row = (int)((position.y - origin.y) / cellSize);
+		column = column < 0 ? 0 : (column >= columns ? columns - 1 : column);
+		row = row < 0 ? 0 : (row >= rows ? rows - 1 : row);
+		return row * columns + column;
+	}
+};
+
+class FizziksComputeSolver
+{
+public:
+	// What upload() sent and download()/readBodies() got back. bodies[i] is circles[i]
+	std::vector<FizziksComputeBody> bodies;
+	std::vector<FizziksCircle*> circles;
+	std::vector<FizziksComputeHalfspace> halfspaces;
+	std::vector<FizziksHalfspace*> halfspaceObjekts;
+
+	FizziksComputeGrid grid;
+	Vector2 gravity = { 0,0 }; // in px/s^2
+	FizziksIntegrator integrator = SYMPLECTIC_EULER; // EXPLICIT_EULER or SYMPLECTIC_EULER
+
+	// Compiles the shaders. Returns false (and everything else does nothing) without OpenGL 4.3 compute shaders
+	bool load();
+	void unload();
+
+	bool isLoaded() const
+	{
+		return loaded;
+	}
+
+	// True if every objekt and setting in the world is something the shaders know how to simulate
+	bool canSimulate(const FizziksWorld& world) const;
+
+	// Packs the world's circles and halfspaces into bodies/halfspaces and sends them
+	void upload(const FizziksWorld& world);
+
+	// Sends bodies and halfspaces as they are, and works out a grid that fits them
+	void uploadBodies();
+
+	// One physics step of dt seconds on the GPU
+	void step(float dt);
+
+	// Reads the bodies back into bodies/halfspaces
+	void readBodies();
+
+	// readBodies(), then copies positions, velocities and colours into the world's objekts
+	void download(FizziksWorld& world);
+
+	// Draws every body as an anti-aliased disc, reading positions straight from the GPU buffer.
+	// Uses the current modelview/projection, like DrawCircle
+	void drawCircles();
+
+	// Circles that didn't fit in their cell since the last upload (the other circles couldn't see them). Reads from the GPU
+	unsigned int overflowCount();
+
+	// The same step as the shaders, on the CPU, using the grid and settings of the last upload. For checking the GPU
+	void stepReference(std::vector<FizziksComputeBody>& stepBodies, std::vector<FizziksComputeHalfspace>& stepHalfspaces, float dt) const;
+
+private:
+	bool loaded = false;
+	unsigned int clearProgram = 0;
+	unsigned int binProgram = 0;
+	unsigned int stepProgram = 0;
+	unsigned int drawProgram = 0;
+	int drawMvpLocation = -1;
+	unsigned int emptyVertexArray = 0; // Core profile can't draw without a vertex array, even one with no attributes
+
+	unsigned int bodyBuffers[2] = { 0, 0 }; // Ping-pong: step reads one and writes the other
+	int currentBodies = 0; // Which of bodyBuffers holds the latest positions
+	int bodyCapacity = 0;
+	unsigned int halfspaceBuffer = 0;
+	int halfspaceCapacity = 0;
+	unsigned int cellCountBuffer = 0;
+	unsigned int cellBodyBuffer = 0;
+	int cellCapacityLoaded = 0; // cellCount() * cellCapacity the cell buffers have room for
+	unsigned int counterBuffer = 0;
+
+	void setGridUniforms(unsigned int program, float dt);
+};
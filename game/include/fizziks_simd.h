@@ -0,0 +1,108 @@
+#pragma once
+
+/*
+Four floats processed at once with a single CPU instruction (SIMD = Single Instruction, Multiple Data).
+
+Used by the batch physics loops that walk the sorted SoA arrays (FizziksCircleGrid), e.g.
+	FizziksFloat4 dx = FizziksFloat4::load(&x[j]) - FizziksFloat4(xi);
+works on bodies j, j+1, j+2 and j+3 together.
+
+Comparisons return a mask (all bits set in lanes where true), which is applied with select()
+instead of an if, so lanes that fail the test just add zero.
+
+x86 uses SSE2, ARM64 uses NEON, anything else falls back to plain loops over 4 floats.
+*/
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FIZZIKS_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define FIZZIKS_SIMD_NEON
+#include <arm_neon.h>
+#else
+#include <math.h>
+#include <string.h>
+#endif
+
+struct FizziksFloat4
+{
+#if defined(FIZZIKS_SIMD_SSE2)
+	__m128 v;
+
+	FizziksFloat4() : v(_mm_setzero_ps()) {}
+	FizziksFloat4(float value) : v(_mm_set1_ps(value)) {}
+	FizziksFloat4(__m128 value) : v(value) {}
+
+	static FizziksFloat4 load(const float* from) { return _mm_loadu_ps(from); }
+	void store(float* to) const { _mm_storeu_ps(to, v); }
+#elif defined(FIZZIKS_SIMD_NEON)
+	float32x4_t v;
+
+	FizziksFloat4() : v(vdupq_n_f32(0)) {}
+	FizziksFloat4(float value) : v(vdupq_n_f32(value)) {}
+	FizziksFloat4(float32x4_t value) : v(value) {}
+
+	static FizziksFloat4 load(const float* from) { return vld1q_f32(from); }
+	void store(float* to) const { vst1q_f32(to, v); }
+#else
+	float v[4];
+
+	FizziksFloat4() { v[0] = v[1] = v[2] = v[3] = 0; }
+	FizziksFloat4(float value) { v[0] = v[1] = v[2] = v[3] = value; }
+
+	static FizziksFloat4 load(const float* from) { FizziksFloat4 result; memcpy(result.v, from, sizeof(result.v)); return result; }
+	void store(float* to) const { memcpy(to, v, sizeof(v)); }
+#endif
+};
+
+#if defined(FIZZIKS_SIMD_SSE2)
+
+inline FizziksFloat4 operator+(FizziksFloat4 a, FizziksFloat4 b) { return _mm_add_ps(a.v, b.v); }
+inline FizziksFloat4 operator-(FizziksFloat4 a, FizziksFloat4 b) { return _mm_sub_ps(a.v, b.v); }
+inline FizziksFloat4 operator*(FizziksFloat4 a, FizziksFloat4 b) { return _mm_mul_ps(a.v, b.v); }
+inline FizziksFloat4 operator/(FizziksFloat4 a, FizziksFloat4 b) { return _mm_div_ps(a.v, b.v); }
+inline FizziksFloat4 Min4(FizziksFloat4 a, FizziksFloat4 b) { return _mm_min_ps(a.v, b.v); }
+inline FizziksFloat4 Max4(FizziksFloat4 a, FizziksFloat4 b) { return _mm_max_ps(a.v, b.v); }
+inline FizziksFloat4 Sqrt4(FizziksFloat4 a) { return _mm_sqrt_ps(a.v); }
+inline FizziksFloat4 LessThan4(FizziksFloat4 a, FizziksFloat4 b) { return _mm_cmplt_ps(a.v, b.v); }
+inline FizziksFloat4 And4(FizziksFloat4 a, FizziksFloat4 b) { return _mm_and_ps(a.v, b.v); }
+// mask ? value : 0
+inline FizziksFloat4 Select4(FizziksFloat4 mask, FizziksFloat4 value) { return _mm_and_ps(mask.v, value.v); }
+inline float Sum4(FizziksFloat4 a)
+{
+	__m128 pairs = _mm_add_ps(a.v, _mm_movehl_ps(a.v, a.v));
+	return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+}
+
+#elif defined(FIZZIKS_SIMD_NEON)
+
+inline FizziksFloat4 operator+(FizziksFloat4 a, FizziksFloat4 b) { return vaddq_f32(a.v, b.v); }
+inline FizziksFloat4 operator-(FizziksFloat4 a, FizziksFloat4 b) { return vsubq_f32(a.v, b.v); }
+inline FizziksFloat4 operator*(FizziksFloat4 a, FizziksFloat4 b) { return vmulq_f32(a.v, b.v); }
+inline FizziksFloat4 operator/(FizziksFloat4 a, FizziksFloat4 b) { return vdivq_f32(a.v, b.v); }
+inline FizziksFloat4 Min4(FizziksFloat4 a, FizziksFloat4 b) { return vminq_f32(a.v, b.v); }
+inline FizziksFloat4 Max4(FizziksFloat4 a, FizziksFloat4 b) { return vmaxq_f32(a.v, b.v); }
+inline FizziksFloat4 Sqrt4(FizziksFloat4 a) { return vsqrtq_f32(a.v); }
+inline FizziksFloat4 LessThan4(FizziksFloat4 a, FizziksFloat4 b) { return vreinterpretq_f32_u32(vcltq_f32(a.v, b.v)); }
+inline FizziksFloat4 And4(FizziksFloat4 a, FizziksFloat4 b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v))); }
+inline FizziksFloat4 Select4(FizziksFloat4 mask, FizziksFloat4 value) { return And4(mask, value); }
+inline float Sum4(FizziksFloat4 a) { return vaddvq_f32(a.v); }
+
+#else
+
+#define FIZZIKS_FLOAT4_EACH(expression) FizziksFloat4 r; for (int i = 0; i < 4; i++) r.v[i] = (expression); return r;
+inline FizziksFloat4 operator+(FizziksFloat4 a, FizziksFloat4 b) { FIZZIKS_FLOAT4_EACH(a.v[i] + b.v[i]) }
+inline FizziksFloat4 operator-(FizziksFloat4 a, FizziksFloat4 b) { FIZZIKS_FLOAT4_EACH(a.v[i] - b.v[i]) }
+inline FizziksFloat4 operator*(FizziksFloat4 a, FizziksFloat4 b) { FIZZIKS_FLOAT4_EACH(a.v[i] * b.v[i]) }
+inline FizziksFloat4 operator/(FizziksFloat4 a, FizziksFloat4 b) { FIZZIKS_FLOAT4_EACH(a.v[i] / b.v[i]) }
+inline FizziksFloat4 Min4(FizziksFloat4 a, FizziksFloat4 b) { FIZZIKS_FLOAT4_EACH(a.v[i] < b.v[i] ? a.v[i] : b.v[i]) }
+inline FizziksFloat4 Max4(FizziksFloat4 a, FizziksFloat4 b) { FIZZIKS_FLOAT4_EACH(a.v[i] > b.v[i] ? a.v[i] : b.v[i]) }
+inline FizziksFloat4 Sqrt4(FizziksFloat4 a) { FIZZIKS_FLOAT4_EACH(sqrtf(a.v[i])) }
+// Masks are stored as 1 or 0 here instead of all bits set, Select4 multiplies by them
+inline FizziksFloat4 LessThan4(FizziksFloat4 a, FizziksFloat4 b) { FIZZIKS_FLOAT4_EACH(a.v[i] < b.v[i] ? 1.0f : 0.0f) }
+inline FizziksFloat4 And4(FizziksFloat4 a, FizziksFloat4 b) { FIZZIKS_FLOAT4_EACH(a.v[i] * b.v[i]) }
+inline FizziksFloat4 Select4(FizziksFloat4 mask, FizziksFloat4 value) { FIZZIKS_FLOAT4_EACH(mask.v[i] != 0 ? value.v[i] : 0.0f) }
+inline float Sum4(FizziksFloat4 a) { return (a.v[0] + a.v[1]) + (a.v[2] + a.v[3]); }
+#undef FIZZIKS_FLOAT4_EACH
+
+#endif
@@ -0,0 +1,129 @@
+#pragma once
+
+/*
+A small pool of worker threads for splitting big physics loops across CPU cores.
+
+Usage:
+	threads.parallelFor(count, 256, [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++) { ... }
+	});
+
+The loop [0, count) is cut into chunks of at least minChunk items. Workers (and the calling thread)
+grab chunks until none are left, and parallelFor only returns once every chunk is finished.
+Chunks run at the same time, so the job must never write to data that another chunk touches.
+parallelFor must not be called from inside a job.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class FizziksThreadPool
+{
+private:
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable wakeWorkers;
+	std::condition_variable workersDone;
+
+	const std::function<void(int, int)>* job = nullptr; // Job currently being run, only valid during parallelFor
+	int jobCount = 0;
+	int chunkSize = 1;
+	std::atomic<int> nextChunkStart{ 0 };
+	int busyWorkers = 0;
+	unsigned int generation = 0; // Bumped once per parallelFor so sleeping workers know there is new work
+	bool quitting = false;
+
+	void runChunks()
+	{
+		while (true)
+		{
+			int begin = nextChunkStart.fetch_add(chunkSize);
+			if (begin >= jobCount) break;
+			(*job)(begin, std::min(begin + chunkSize, jobCount));
+		}
+	}
+
+	void workerLoop()
+	{
+		unsigned int seenGeneration = 0;
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				wakeWorkers.wait(lock, [&] { return quitting || generation != seenGeneration; });
+				if (quitting) return;
+				seenGeneration = generation;
+			}
+
+			runChunks();
+
+			std::lock_guard<std::mutex> lock(mutex);
+			busyWorkers--;
+			if (busyWorkers == 0) workersDone.notify_one();
+		}
+	}
+
+public:
+	// threadCount includes the calling thread, so 1 means "run everything on the caller"
+	explicit FizziksThreadPool(unsigned int threadCount = std::thread::hardware_concurrency())
+	{
+		for (unsigned int i = 1; i < threadCount; i++)
+		{
+			workers.emplace_back(&FizziksThreadPool::workerLoop, this);
+		}
+	}
+
+	~FizziksThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			quitting = true;
+		}
+		wakeWorkers.notify_all();
+		for (std::thread& worker : workers) worker.join();
+	}
+
+	FizziksThreadPool(const FizziksThreadPool&) = delete;
+	FizziksThreadPool& operator=(const FizziksThreadPool&) = delete;
+
+	// Number of threads that share the work, including the caller
+	int size() const
+	{
+		return (int)workers.size() + 1;
+	}
+
+	void parallelFor(int count, int minChunk, const std::function<void(int begin, int end)>& function)
+	{
+		if (count <= 0) return;
+
+		// Not worth waking anybody up for
+		if (workers.empty() || count <= minChunk)
+		{
+			function(0, count);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			job = &function;
+			jobCount = count;
+			chunkSize = std::max(std::max(minChunk, 1), count / (size() * 4)); // ~4 chunks per thread evens out uneven work
+			nextChunkStart = 0;
+			busyWorkers = (int)workers.size();
+			generation++;
+		}
+		wakeWorkers.notify_all();
+
+		runChunks(); // The caller helps instead of just waiting
+
+		std::unique_lock<std::mutex> lock(mutex);
+		workersDone.wait(lock, [&] { return busyWorkers == 0; });
+		job = nullptr;
+	}
+};
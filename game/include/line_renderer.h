@@ -0,0 +1,63 @@
+#pragma once
+
+/*
+Draws thousands of thick lines (the debug view's velocity, gravity, normal and friction vectors) with one draw call.
+
+Usage:
+	LineRenderer lines;
+	lines.load();                      // after InitWindow
+	lines.add(start, end, 1, RED);     // every frame, as many as you like
+	lines.draw();                      // draws them all on top of what was drawn before, then empties the list
+	lines.unload();                    // before CloseWindow
+
+Every line is one instance: its endpoints, thickness and colour (24 bytes) go into an instance buffer, and the
+vertex shader turns each instance into a quad around the segment. The fragment shader works out how far every
+pixel is from the segment (the signed distance field of a capsule), so lines get round ends, lines meeting at a
+point join cleanly instead of showing notches, and edges are anti-aliased over one pixel.
+
+Compare with DrawLineEx: there the CPU builds 4 vertices per line (36 bytes each) into raylib's batch, and each
+line ends in a square cut.
+
+Without OpenGL 3.3 (or if the shader fails to compile) draw() falls back to DrawLineEx, one quad per line.
+*/
+
+#include "raylib.h"
+#include <vector>
+
+struct LineInstance
+{
+	Vector2 start;
+	Vector2 end;
+	float thickness;
+	Color color;
+};
+
+class LineRenderer
+{
+public:
+	std::vector<LineInstance> lines; // Lines waiting for the next draw()
+
+	void load();
+	void unload();
+
+	void add(Vector2 start, Vector2 end, float thickness, Color color)
+	{
+		lines.push_back({ start, end, thickness, color });
+	}
+
+	void draw();
+
+	// False means lines are drawn with DrawLineEx
+	bool usesShader() const { return sdfSupported; }
+
+private:
+	bool sdfSupported = false;
+	Shader shader = {};
+	int mvpLocation = -1;
+	unsigned int vertexArray = 0;
+	unsigned int cornerBuffer = 0;   // The 6 corners of the quad every line is drawn with
+	unsigned int instanceBuffer = 0; // One LineInstance per line
+	int instanceCapacity = 0;        // How many lines fit in instanceBuffer
+
+	void loadInstanceBuffer(int capacity);
+};
@@ -0,0 +1,1244 @@
+#include "fizziks.h"
+#include <algorithm>
+#include <unordered_map>
+
+const char* FizziksIntegratorName(FizziksIntegrator integrator)
+{
+	switch (integrator)
+	{
+	case EXPLICIT_EULER: return "Explicit Euler";
+	case SYMPLECTIC_EULER: return "Symplectic Euler";
+	case VELOCITY_VERLET: return "Velocity Verlet";
+	case POSITION_VERLET: return "Position Verlet";
+	}
+	return "?";
+}
+
+/// 
+/// Constraints
+/// 
+
+float InverseMass(FizziksObjekt* objekt)
+{
+	return objekt->isStatic ? 0.0f : 1.0f / objekt->mass;
+}
+
+void FizziksDistanceConstraint::solve(float substepDt)
+{
+	Vector2 displacementFromBToA = a->position - b->position;
+	float distance = Vector2Length(displacementFromBToA);
+	if (distance < 0.0001f) return; // No sensible direction to push in
+
+	float C = distance - restLength; // How wrong we are. 0 = satisfied
+	if (isRope && C < 0) return; // Slack rope doesn't push
+
+	float wA = InverseMass(a);
+	float wB = InverseMass(b);
+	float alphaTilde = compliance / (substepDt * substepDt);
+	if (wA + wB + alphaTilde <= 0) return; // Both static
+
+	// Move both objekts along the line between them, lighter objekts move further
+	float deltaLambda = (-C - alphaTilde * lambda) / (wA + wB + alphaTilde);
+	lambda += deltaLambda;
+
+	Vector2 direction = displacementFromBToA / distance;
+	if (wA > 0) a->position += direction * (wA * deltaLambda);
+	if (wB > 0) b->position -= direction * (wB * deltaLambda);
+}
+
+void FizziksPinConstraint::solve(float substepDt)
+{
+	float w = InverseMass(objekt);
+	if (w <= 0) return;
+
+	Vector2 displacementFromAnchor = objekt->position - anchor;
+	float distance = Vector2Length(displacementFromAnchor);
+	if (distance < 0.0001f) return; // Sitting right on the anchor, no sensible direction to push in
+
+	float C = distance - length;
+	float alphaTilde = compliance / (substepDt * substepDt);
+	float deltaLambda = (-C - alphaTilde * lambda) / (w + alphaTilde);
+	lambda += deltaLambda;
+
+	objekt->position += (displacementFromAnchor / distance) * (w * deltaLambda);
+}
+
+void FizziksHingeConstraint::solve(float substepDt)
+{
+	Vector2 u = a->position - b->position;
+	Vector2 v = c->position - b->position;
+	float lengthSqrU = Vector2LengthSqr(u);
+	float lengthSqrV = Vector2LengthSqr(v);
+	if (lengthSqrU < 0.0001f || lengthSqrV < 0.0001f) return;
+
+	// Signed angle from u to v
+	float angle = atan2f(u.x * v.y - u.y * v.x, Vector2DotProduct(u, v));
+	float C = 0;
+	if (angle < minAngle) C = angle - minAngle;
+	else if (angle > maxAngle) C = angle - maxAngle;
+	else return; // Inside the allowed range
+
+	// Which way each objekt should move to increase the angle (gradient of the angle)
+	Vector2 gradientA = Vector2{ u.y, -u.x } / lengthSqrU;
+	Vector2 gradientC = Vector2{ -v.y, v.x } / lengthSqrV;
+	Vector2 gradientB = (gradientA + gradientC) * -1;
+
+	float wA = InverseMass(a);
+	float wB = InverseMass(b);
+	float wC = InverseMass(c);
+	float alphaTilde = compliance / (substepDt * substepDt);
+	float denominator = wA * Vector2LengthSqr(gradientA) + wB * Vector2LengthSqr(gradientB) + wC * Vector2LengthSqr(gradientC) + alphaTilde;
+	if (denominator <= 0) return;
+
+	float deltaLambda = (-C - alphaTilde * lambda) / denominator;
+	lambda += deltaLambda;
+
+	if (wA > 0) a->position += gradientA * (wA * deltaLambda);
+	if (wB > 0) b->position += gradientB * (wB * deltaLambda);
+	if (wC > 0) c->position += gradientC * (wC * deltaLambda);
+}
+
+/// 
+/// Neighbour Grid
+/// 
+
+void FizziksCircleGrid::build(const std::vector<FizziksObjekt*>& objekts, float minimumCellSize)
+{
+	circles.clear();
+	for (int i = 0; i < objekts.size(); i++)
+	{
+		if (objekts[i]->Shape() == CIRCLE) circles.push_back((FizziksCircle*)objekts[i]);
+	}
+
+	int n = (int)circles.size();
+	Vector2 boundsMin = { 0,0 };
+	Vector2 boundsMax = { 0,0 };
+	if (n > 0) boundsMin = boundsMax = circles[0]->position;
+	for (int i = 1; i < n; i++)
+	{
+		boundsMin = Vector2Min(boundsMin, circles[i]->position);
+		boundsMax = Vector2Max(boundsMax, circles[i]->position);
+	}
+
+	// Keep the number of cells in proportion to the number of circles, even if one flies off far away.
+	// Bigger cells are always correct, just slower
+	origin = boundsMin;
+	cellSize = minimumCellSize > 1 ? minimumCellSize : 1;
+	while (true)
+	{
+		columns = (int)((boundsMax.x - boundsMin.x) / cellSize) + 1;
+		rows = (int)((boundsMax.y - boundsMin.y) / cellSize) + 1;
+		if ((long long)columns * rows <= 4LL * n + 64) break;
+		cellSize *= 2;
+	}
+
+	// Counting sort: count circles per cell, turn counts into start offsets, then drop each circle into place
+	std::vector<int> cellOfCircle(n);
+	cellStart.assign(columns * rows + 1, 0);
+	for (int i = 0; i < n; i++)
+	{
+		cellOfCircle[i] = cellRow(circles[i]->position.y) * columns + cellColumn(circles[i]->position.x);
+		cellStart[cellOfCircle[i] + 1]++;
+	}
+	for (int c = 0; c < columns * rows; c++)
+	{
+		cellStart[c + 1] += cellStart[c];
+	}
+
+	std::vector<FizziksCircle*> unsorted;
+	unsorted.swap(circles);
+	circles.resize(n);
+	x.resize(n);
+	y.resize(n);
+	vx.resize(n);
+	vy.resize(n);
+	mass.resize(n);
+	fluidMass.resize(n);
+	fluidCount = 0;
+
+	std::vector<int> nextSlot(cellStart.begin(), cellStart.end() - 1);
+	for (int i = 0; i < n; i++)
+	{
+		int slot = nextSlot[cellOfCircle[i]]++;
+		FizziksCircle* circle = unsorted[i];
+		circles[slot] = circle;
+		x[slot] = circle->position.x;
+		y[slot] = circle->position.y;
+		vx[slot] = circle->velocity.x;
+		vy[slot] = circle->velocity.y;
+		mass[slot] = circle->mass;
+		fluidMass[slot] = circle->isFluid ? circle->mass : 0.0f;
+		if (circle->isFluid) fluidCount++;
+	}
+}
+
+/// 
+/// Mutual Gravity
+/// 
+
+void FizziksQuadtree::build(const FizziksCircleGrid& grid, FizziksThreadPool& threads)
+{
+	nodes.clear();
+	int n = grid.size();
+	if (n == 0) return;
+
+	// Square around everything
+	float minX = grid.x[0], maxX = grid.x[0], minY = grid.y[0], maxY = grid.y[0];
+	for (int i = 1; i < n; i++)
+	{
+		minX = fminf(minX, grid.x[i]);
+		maxX = fmaxf(maxX, grid.x[i]);
+		minY = fminf(minY, grid.y[i]);
+		maxY = fmaxf(maxY, grid.y[i]);
+	}
+	float halfSize = fmaxf(maxX - minX, maxY - minY) * 0.5f + 1;
+	float rootX = (minX + maxX) * 0.5f;
+	float rootY = (minY + maxY) * 0.5f;
+
+	// The top of the tree is complete down to parallelDepth. Number the squares at that depth along a Z curve,
+	// then square k's children at the next level are 4k to 4k+3, which is the same numbering the nodes use
+	const int side = 1 << parallelDepth;
+	const int bucketCount = side * side;
+	std::vector<int> bucketOfBody(n);
+	std::vector<int> bucketStart(bucketCount + 1, 0);
+	for (int i = 0; i < n; i++)
+	{
+		int column = (int)((grid.x[i] - (rootX - halfSize)) / (2 * halfSize) * side);
+		int row = (int)((grid.y[i] - (rootY - halfSize)) / (2 * halfSize) * side);
+		column = std::min(std::max(column, 0), side - 1);
+		row = std::min(std::max(row, 0), side - 1);
+
+		int bucket = 0;
+		for (int bit = parallelDepth - 1; bit >= 0; bit--)
+		{
+			bucket = bucket * 4 + ((column >> bit) & 1) + (((row >> bit) & 1) << 1);
+		}
+		bucketOfBody[i] = bucket;
+		bucketStart[bucket + 1]++;
+	}
+	for (int b = 0; b < bucketCount; b++) bucketStart[b + 1] += bucketStart[b];
+
+	gridSlot.resize(n);
+	std::vector<int> nextSlot(bucketStart.begin(), bucketStart.end() - 1);
+	for (int i = 0; i < n; i++) gridSlot[nextSlot[bucketOfBody[i]]++] = i;
+
+	// Top levels: level L starts at node (4^L - 1) / 3
+	int topNodeCount = (bucketCount * 4 - 1) / 3;
+	int bucketLevelStart = (bucketCount - 1) / 3;
+	nodes.resize(topNodeCount);
+	for (int level = 0, levelStart = 0; level <= parallelDepth; levelStart += 1 << (2 * level), level++)
+	{
+		int levelSide = 1 << level;
+		float nodeHalfSize = halfSize / levelSide;
+		for (int k = 0; k < levelSide * levelSide; k++)
+		{
+			// Undo the Z curve numbering to find where this square is
+			int column = 0, row = 0;
+			for (int bit = 0; bit < level; bit++)
+			{
+				column |= ((k >> (2 * bit)) & 1) << bit;
+				row |= ((k >> (2 * bit + 1)) & 1) << bit;
+			}
+			Node& node = nodes[levelStart + k];
+			node.centreX = rootX - halfSize + (2 * column + 1) * nodeHalfSize;
+			node.centreY = rootY - halfSize + (2 * row + 1) * nodeHalfSize;
+			node.halfSize = nodeHalfSize;
+			node.firstChild = level < parallelDepth ? levelStart + levelSide * levelSide + 4 * k : -1;
+		}
+	}
+
+	// Subtrees, one per bucket, in parallel. Each fills its own node list, which are stitched together after
+	std::vector<std::vector<Node>> subtrees(bucketCount);
+	threads.parallelFor(bucketCount, 1, [&](int begin, int end)
+	{
+		for (int b = begin; b < end; b++)
+		{
+			std::vector<Node>& subtree = subtrees[b];
+			subtree.clear();
+			subtree.push_back(nodes[bucketLevelStart + b]);
+			buildNode(grid, subtree, 0, bucketStart[b], bucketStart[b + 1], parallelDepth);
+		}
+	});
+
+	std::vector<int> subtreeOffset(bucketCount);
+	int totalNodes = topNodeCount;
+	for (int b = 0; b < bucketCount; b++)
+	{
+		subtreeOffset[b] = totalNodes - 1; // Local node 0 replaces the bucket node, local node k > 0 goes to offset + k
+		totalNodes += (int)subtrees[b].size() - 1;
+	}
+	nodes.resize(totalNodes);
+
+	threads.parallelFor(bucketCount, 1, [&](int begin, int end)
+	{
+		for (int b = begin; b < end; b++)
+		{
+			for (int k = 0; k < subtrees[b].size(); k++)
+			{
+				Node node = subtrees[b][k];
+				if (node.firstChild >= 0) node.firstChild += subtreeOffset[b];
+				nodes[k == 0 ? bucketLevelStart + b : subtreeOffset[b] + k] = node;
+			}
+		}
+	});
+
+	// Top levels' centres of mass, from the bottom up
+	for (int i = bucketLevelStart - 1; i >= 0; i--)
+	{
+		sumChildren(nodes[i], nodes.data());
+	}
+
+	// Copy bodies into tree order
+	x.resize(n);
+	y.resize(n);
+	mass.resize(n);
+	threads.parallelFor(n, 4096, [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			x[i] = grid.x[gridSlot[i]];
+			y[i] = grid.y[gridSlot[i]];
+			mass[i] = grid.mass[gridSlot[i]];
+		}
+	});
+}
+
+Vector2 FizziksQuadtree::acceleration(float px, float py, const FizziksMutualGravitySettings& settings) const
+{
+	if (nodes.empty()) return { 0,0 };
+
+	const float thetaSqr = settings.theta * settings.theta;
+	const float softeningSqr = settings.softening * settings.softening + 0.0001f;
+	FizziksFloat4 px4 = px, py4 = py, softening4 = softeningSqr;
+	FizziksFloat4 ax4, ay4;
+	float ax = 0, ay = 0;
+
+	int stack[4 * maxDepth + 8];
+	int stackSize = 0;
+	stack[stackSize++] = 0;
+	while (stackSize > 0)
+	{
+		const Node& node = nodes[stack[--stackSize]];
+		if (node.mass <= 0) continue;
+
+		float dx = node.massX - px;
+		float dy = node.massY - py;
+		float distanceSqr = dx * dx + dy * dy;
+		float size = node.halfSize * 2;
+
+		if (node.firstChild < 0)
+		{
+			// Leaf: add each body. The body itself is at distance 0, so it adds nothing
+			int i = node.begin;
+			for (; i + 4 <= node.end; i += 4)
+			{
+				FizziksFloat4 bx = FizziksFloat4::load(&x[i]) - px4;
+				FizziksFloat4 by = FizziksFloat4::load(&y[i]) - py4;
+				FizziksFloat4 r2 = bx * bx + by * by + softening4;
+				FizziksFloat4 scale = FizziksFloat4::load(&mass[i]) / (r2 * Sqrt4(r2));
+				ax4 = ax4 + bx * scale;
+				ay4 = ay4 + by * scale;
+			}
+			for (; i < node.end; i++)
+			{
+				float bx = x[i] - px;
+				float by = y[i] - py;
+				float r2 = bx * bx + by * by + softeningSqr;
+				float scale = mass[i] / (r2 * sqrtf(r2));
+				ax += bx * scale;
+				ay += by * scale;
+			}
+		}
+		else if (size * size < thetaSqr * distanceSqr)
+		{
+			// Far away: the whole node pulls like one body at its centre of mass
+			float r2 = distanceSqr + softeningSqr;
+			float scale = node.mass / (r2 * sqrtf(r2));
+			ax += dx * scale;
+			ay += dy * scale;
+		}
+		else
+		{
+			for (int c = 0; c < 4; c++) stack[stackSize++] = node.firstChild + c;
+		}
+	}
+
+	return Vector2{ ax + Sum4(ax4), ay + Sum4(ay4) } * settings.G;
+}
+
+void FizziksQuadtree::sumChildren(Node& node, const Node* allNodes)
+{
+	node.mass = 0;
+	node.massX = 0;
+	node.massY = 0;
+	for (int c = 0; c < 4; c++)
+	{
+		const Node& child = allNodes[node.firstChild + c];
+		node.mass += child.mass;
+		node.massX += child.massX * child.mass;
+		node.massY += child.massY * child.mass;
+	}
+	if (node.mass > 0)
+	{
+		node.massX /= node.mass;
+		node.massY /= node.mass;
+	}
+}
+
+void FizziksQuadtree::buildNode(const FizziksCircleGrid& grid, std::vector<Node>& subtree, int nodeIndex, int begin, int end, int depth)
+{
+	subtree[nodeIndex].begin = begin;
+	subtree[nodeIndex].end = end;
+
+	if (end - begin <= leafSize || depth >= maxDepth)
+	{
+		Node& leaf = subtree[nodeIndex];
+		leaf.firstChild = -1;
+		leaf.mass = 0;
+		leaf.massX = 0;
+		leaf.massY = 0;
+		for (int i = begin; i < end; i++)
+		{
+			int slot = gridSlot[i];
+			leaf.mass += grid.mass[slot];
+			leaf.massX += grid.x[slot] * grid.mass[slot];
+			leaf.massY += grid.y[slot] * grid.mass[slot];
+		}
+		if (leaf.mass > 0)
+		{
+			leaf.massX /= leaf.mass;
+			leaf.massY /= leaf.mass;
+		}
+		return;
+	}
+
+	// Split the bodies into top/bottom, then each half into left/right, in the same order as the children
+	float centreX = subtree[nodeIndex].centreX;
+	float centreY = subtree[nodeIndex].centreY;
+	float childHalfSize = subtree[nodeIndex].halfSize * 0.5f;
+	int* first = gridSlot.data() + begin;
+	int* last = gridSlot.data() + end;
+	int* bottom = std::partition(first, last, [&](int slot) { return grid.y[slot] < centreY; });
+	int* topRight = std::partition(first, bottom, [&](int slot) { return grid.x[slot] < centreX; });
+	int* bottomRight = std::partition(bottom, last, [&](int slot) { return grid.x[slot] < centreX; });
+	int splits[5] = { begin, (int)(topRight - gridSlot.data()), (int)(bottom - gridSlot.data()), (int)(bottomRight - gridSlot.data()), end };
+
+	int firstChild = (int)subtree.size();
+	subtree[nodeIndex].firstChild = firstChild;
+	subtree.resize(firstChild + 4); // Careful, this can move subtree, don't hold references across it
+	for (int c = 0; c < 4; c++)
+	{
+		Node& child = subtree[firstChild + c];
+		child.halfSize = childHalfSize;
+		child.centreX = centreX + ((c & 1) ? childHalfSize : -childHalfSize);
+		child.centreY = centreY + ((c & 2) ? childHalfSize : -childHalfSize);
+	}
+	for (int c = 0; c < 4; c++)
+	{
+		buildNode(grid, subtree, firstChild + c, splits[c], splits[c + 1], depth + 1);
+	}
+
+	sumChildren(subtree[nodeIndex], subtree.data());
+}
+
+/// 
+/// World
+/// 
+
+void FizziksWorld::add(FizziksObjekt* newObject)
+{
+	newObject->name = std::to_string(objektCount);
+
+	// The Verlet integrators need to remember the last step. A new object has no last step,
+	// so pretend it was falling freely: that is exactly right for anything launched into the air
+	newObject->acceleration = accelerationGravity;
+	newObject->previousPosition = newObject->position - newObject->velocity * dt + accelerationGravity * (0.5f * dt * dt);
+
+	objekts.push_back(newObject);
+	objektCount++;
+}
+
+void FizziksWorld::addConstraint(FizziksConstraint* newConstraint)
+{
+	constraints.push_back(newConstraint);
+	constraintColoursDirty = true;
+}
+
+void FizziksWorld::removeConstraintsOf(FizziksObjekt* objekt)
+{
+	for (int i = 0; i < constraints.size(); i++)
+	{
+		FizziksObjekt* attached[3];
+		int attachedCount = constraints[i]->getObjekts(attached);
+		for (int j = 0; j < attachedCount; j++)
+		{
+			if (attached[j] == objekt)
+			{
+				delete constraints[i];
+				constraints.erase(constraints.begin() + i);
+				constraintColoursDirty = true;
+				i--;
+				break;
+			}
+		}
+	}
+}
+
+void FizziksWorld::resetNetForces()
+{
+	for (int i = 0; i < objekts.size(); i++)
+	{
+		objekts[i]->netForce = { 0,0 };
+	}
+}
+
+void FizziksWorld::addGravityForce()
+{
+	for (int i = 0; i < objekts.size(); i++)
+	{
+		FizziksObjekt* objekt = objekts[i];
+
+		// Avoid modifying position and applying gravity to objects we label "static"
+		if (objekt->isStatic) continue;
+
+		// F = ma therefore Fg = object mass * acceleration due to gravity
+		Vector2 FGravity = accelerationGravity * objekt->mass;
+		objekt->netForce += FGravity;
+		addDebugLine(objekt->position, objekt->position - FGravity, 1, PURPLE);
+	}
+}
+
+void FizziksWorld::applyKinematics()
+{
+	for (int i = 0; i < objekts.size(); i++)
+	{
+		FizziksObjekt* objekt = objekts[i];
+
+		// Avoid modifying position and applying gravity to objects we label "static"
+		if (objekt->isStatic) continue;
+
+		Vector2 acceleration = objekt->netForce/objekt->mass; // F = ma, so a = F/m where F is net force on an object
+
+		switch (integrator)
+		{
+		case EXPLICIT_EULER:
+			//vel = change in position / time, therefore     change in position = vel * time 
+			objekt->position = objekt->position + objekt->velocity * dt;
+
+			//accel = deltaV / time (change in velocity over time) therefore     deltaV = accel * time
+			objekt->velocity = objekt->velocity + acceleration * dt;
+			break;
+
+		case SYMPLECTIC_EULER:
+			// Same two equations, but swapped: accelerate first, then move with the new velocity
+			objekt->velocity = objekt->velocity + acceleration * dt;
+			objekt->position = objekt->position + objekt->velocity * dt;
+			break;
+
+		case VELOCITY_VERLET:
+			// Last step guessed the velocity assuming acceleration stayed the same.
+			// Now that we know the acceleration here, fix the guess so it uses the average of old and new
+			objekt->velocity = objekt->velocity + (acceleration - objekt->acceleration) * (0.5f * dt);
+
+			// x = x0 + v*t + 1/2*a*t^2
+			objekt->position = objekt->position + objekt->velocity * dt + acceleration * (0.5f * dt * dt);
+
+			// Guess the next velocity, it gets corrected on the next step
+			objekt->velocity = objekt->velocity + acceleration * dt;
+			objekt->acceleration = acceleration;
+			break;
+
+		case POSITION_VERLET:
+		{
+			// Velocity is not stored, it is however far we moved last step.
+			// Collisions that push an object out of a surface therefore change its velocity too
+			Vector2 displacement = objekt->position - objekt->previousPosition;
+			objekt->previousPosition = objekt->position;
+			objekt->position = objekt->position + displacement + acceleration * (dt * dt);
+			objekt->velocity = (objekt->position - objekt->previousPosition) / dt;
+			break;
+		}
+		}
+
+		// Keep the Verlet memory current whichever integrator ran, so switching integrators doesn't fling anything
+		objekt->acceleration = acceleration;
+		if (integrator != POSITION_VERLET) objekt->previousPosition = objekt->position - objekt->velocity * dt;
+
+		//DrawLineEx(objekt->position, objekt->position - objekt->netForce, 4, GRAY);
+	}
+}
+
+void FizziksWorld::update()
+{
+	debugLines.clear();
+
+	resetNetForces(); // Set net forces variable to zero, Fizziksobjekt.netForce tracks all forces applying to it in one frame
+
+	buildGrid(); // Sort circles into cells so neighbour checks are cheap
+
+	addGravityForce(); // Add Gravity Force
+
+	addMutualGravityForce(); // Add every circle's pull on every other circle
+
+	addForceFieldForces(); // Add attractors, vortices, drag and wind
+
+	addFluidForces(); // Add SPH pressure and viscosity forces to fluid circles
+
+	checkCollisions(); // Apply collision Detection and Response, Add Normal Force if applicable
+
+	if (constraints.empty())
+	{
+		applyKinematics(); // Accelerate and Move objects according to a = F/m and kinematics equations
+	}
+	else
+	{
+		solveConstraints(); // Same, but in small substeps that keep constraints satisfied
+	}
+}
+
+void FizziksWorld::colourConstraints()
+{
+	const int maxColours = 64; // One bit per colour in usedColours
+
+	constraintColours.clear();
+	uncolouredConstraints.clear();
+	std::unordered_map<FizziksObjekt*, unsigned long long> usedColours; // Bit i set = objekt is in a constraint of colour i
+
+	for (int i = 0; i < constraints.size(); i++)
+	{
+		FizziksObjekt* attached[3];
+		int attachedCount = constraints[i]->getObjekts(attached);
+
+		unsigned long long taken = 0;
+		for (int j = 0; j < attachedCount; j++)
+		{
+			// Static objekts never move, so sharing them between threads is fine
+			if (!attached[j]->isStatic) taken |= usedColours[attached[j]];
+		}
+
+		int colour = 0;
+		while (colour < maxColours && (taken & (1ull << colour))) colour++;
+
+		if (colour == maxColours)
+		{
+			uncolouredConstraints.push_back(constraints[i]);
+			continue;
+		}
+
+		if (colour >= constraintColours.size()) constraintColours.resize(colour + 1);
+		constraintColours[colour].push_back(constraints[i]);
+		for (int j = 0; j < attachedCount; j++)
+		{
+			if (!attached[j]->isStatic) usedColours[attached[j]] |= 1ull << colour;
+		}
+	}
+
+	constraintColoursDirty = false;
+}
+
+void FizziksWorld::solveConstraints()
+{
+	if (constraintColoursDirty) colourConstraints();
+
+	std::vector<FizziksCircle*> circles;
+	std::vector<FizziksHalfspace*> halfspaces;
+	for (int i = 0; i < objekts.size(); i++)
+	{
+		if (objekts[i]->Shape() == CIRCLE) circles.push_back((FizziksCircle*)objekts[i]);
+		else if (objekts[i]->Shape() == HALF_SPACE) halfspaces.push_back((FizziksHalfspace*)objekts[i]);
+	}
+
+	predictedPositions.resize(objekts.size());
+
+	float h = dt / substeps;
+	for (int step = 0; step < substeps; step++)
+	{
+		// Predict where everything goes with no constraints, using the world's integrator on the substep
+		for (int i = 0; i < objekts.size(); i++)
+		{
+			FizziksObjekt* objekt = objekts[i];
+			if (objekt->isStatic) continue;
+
+			Vector2 acceleration = objekt->netForce / objekt->mass; // Forces don't change between substeps
+			switch (integrator)
+			{
+			case EXPLICIT_EULER:
+				objekt->position += objekt->velocity * h;
+				objekt->velocity += acceleration * h;
+				break;
+
+			case SYMPLECTIC_EULER:
+			case POSITION_VERLET:
+				// Velocity is the last substep's displacement / h, so x + (x - x_previous) + a*h^2 is the same as symplectic Euler here
+				objekt->velocity += acceleration * h;
+				objekt->position += objekt->velocity * h;
+				break;
+
+			case VELOCITY_VERLET:
+				// Fix the guess from the end of the last step, as in applyKinematics
+				if (step == 0) objekt->velocity += (acceleration - objekt->acceleration) * (0.5f * h);
+				objekt->position += objekt->velocity * h + acceleration * (0.5f * h * h);
+				objekt->velocity += acceleration * h;
+				break;
+			}
+			predictedPositions[i] = objekt->position;
+		}
+
+		for (int i = 0; i < constraints.size(); i++)
+		{
+			constraints[i]->lambda = 0;
+		}
+
+		// Then pull everything back into place, one colour at a time
+		for (int iteration = 0; iteration < constraintIterations; iteration++)
+		{
+			for (int colour = 0; colour < constraintColours.size(); colour++)
+			{
+				std::vector<FizziksConstraint*>& group = constraintColours[colour];
+				threads.parallelFor((int)group.size(), 256, [&](int begin, int end)
+				{
+					for (int i = begin; i < end; i++) group[i]->solve(h);
+				});
+			}
+
+			for (int i = 0; i < uncolouredConstraints.size(); i++)
+			{
+				uncolouredConstraints[i]->solve(h);
+			}
+		}
+
+		// Constraints may have dragged circles into each other or into the ground, push them back out
+		solveCircleContacts();
+		for (int i = 0; i < circles.size(); i++)
+		{
+			if (circles[i]->isStatic) continue;
+			for (int j = 0; j < halfspaces.size(); j++)
+			{
+				CircleHalfspacePushOut(circles[i], halfspaces[j]);
+			}
+		}
+
+		// Every correction changes the velocity too: moving dx further in one substep is dx / h faster
+		for (int i = 0; i < objekts.size(); i++)
+		{
+			FizziksObjekt* objekt = objekts[i];
+			if (objekt->isStatic) continue;
+
+			objekt->velocity += (objekt->position - predictedPositions[i]) / h;
+		}
+	}
+
+	// Leave the Verlet memory as if this was one full step, in case the constraints go away
+	for (int i = 0; i < objekts.size(); i++)
+	{
+		if (objekts[i]->isStatic) continue;
+		objekts[i]->previousPosition = objekts[i]->position - objekts[i]->velocity * dt;
+		objekts[i]->acceleration = objekts[i]->netForce / objekts[i]->mass;
+	}
+}
+
+void FizziksWorld::solveCircleContacts()
+{
+	// The grid is from the start of the step. Circles that moved more than a cell since then can miss a contact
+	// until the next step, the same as in checkCollisions
+	for (int i = 0; i < grid.size(); i++)
+	{
+		int begins[3], ends[3];
+		int rangeCount = grid.neighbourRanges(grid.x[i], grid.y[i], begins, ends);
+		for (int range = 0; range < rangeCount; range++)
+		{
+			//j > i so each pair is only checked once
+			for (int j = (begins[range] > i + 1 ? begins[range] : i + 1); j < ends[range]; j++)
+			{
+				FizziksCircle* circleA = grid.circles[i];
+				FizziksCircle* circleB = grid.circles[j];
+
+				if (circleA->isFluid && circleB->isFluid) continue; // Fluid pressure keeps fluid apart
+
+				CircleCirclePushOut(circleA, circleB);
+			}
+		}
+	}
+}
+
+void FizziksWorld::buildGrid()
+{
+	// Cells must fit the biggest pair of touching circles, and the fluid smoothing radius
+	float cellSize = 0;
+	bool hasFluid = false;
+	for (int i = 0; i < objekts.size(); i++)
+	{
+		if (objekts[i]->Shape() != CIRCLE) continue;
+		FizziksCircle* circle = (FizziksCircle*)objekts[i];
+		if (circle->radius * 2 > cellSize) cellSize = circle->radius * 2;
+		hasFluid = hasFluid || circle->isFluid;
+	}
+	if (hasFluid && fluid.smoothingRadius > cellSize) cellSize = fluid.smoothingRadius;
+
+	grid.build(objekts, cellSize);
+}
+
+void FizziksWorld::addMutualGravityForce()
+{
+	if (!mutualGravity.enabled || grid.size() == 0) return;
+
+	quadtree.build(grid, threads);
+
+	// Each circle only writes its own netForce, so they can all go in parallel
+	threads.parallelFor(grid.size(), 256, [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			Vector2 acceleration = quadtree.acceleration(grid.x[i], grid.y[i], mutualGravity);
+			grid.circles[i]->netForce += acceleration * grid.mass[i]; // F = ma
+		}
+	});
+}
+
+void FizziksWorld::applyForceField(const FizziksForceField& field, int begin, int end)
+{
+	const bool everywhere = field.radius <= 0;
+	FizziksFloat4 centreX = field.position.x, centreY = field.position.y;
+	FizziksFloat4 radiusSqr = everywhere ? 1e30f : field.radius * field.radius;
+	FizziksFloat4 inverseRadius = everywhere ? 0.0f : 1.0f / field.radius;
+	FizziksFloat4 strength = field.strength, linearDrag = field.linearDrag, quadraticDrag = field.quadraticDrag;
+	FizziksFloat4 windX = field.type == WIND_FIELD ? field.windVelocity.x : 0.0f;
+	FizziksFloat4 windY = field.type == WIND_FIELD ? field.windVelocity.y : 0.0f;
+	FizziksFloat4 tiny = 0.0001f, one = 1.0f, zero = 0.0f;
+
+	auto batch = [&](const float* x, const float* y, const float* vx, const float* vy, const float* m, float* fx, float* fy)
+	{
+		// Displacement from the circle to the centre of the field
+		FizziksFloat4 dx = centreX - FizziksFloat4::load(x);
+		FizziksFloat4 dy = centreY - FizziksFloat4::load(y);
+		FizziksFloat4 distanceSqr = dx * dx + dy * dy;
+		FizziksFloat4 inside = LessThan4(distanceSqr, radiusSqr);
+		FizziksFloat4 forceX, forceY;
+
+		if (field.type == RADIAL_FIELD || field.type == VORTEX_FIELD)
+		{
+			FizziksFloat4 distance = Sqrt4(Max4(distanceSqr, tiny));
+			FizziksFloat4 falloff = Max4(one - distance * inverseRadius, zero); // 1 at the centre, 0 at radius
+			FizziksFloat4 scale = FizziksFloat4::load(m) * strength * falloff / distance; // F = ma, divided by distance to normalize dx, dy
+			if (field.type == RADIAL_FIELD)
+			{
+				forceX = dx * scale;
+				forceY = dy * scale;
+			}
+			else
+			{
+				forceX = dy * scale;
+				forceY = (zero - dx) * scale;
+			}
+		}
+		else
+		{
+			FizziksFloat4 relativeX = FizziksFloat4::load(vx) - windX;
+			FizziksFloat4 relativeY = FizziksFloat4::load(vy) - windY;
+			FizziksFloat4 speed = Sqrt4(relativeX * relativeX + relativeY * relativeY);
+			FizziksFloat4 k = linearDrag + quadraticDrag * speed;
+			forceX = zero - k * relativeX;
+			forceY = zero - k * relativeY;
+		}
+
+		(FizziksFloat4::load(fx) + Select4(inside, forceX)).store(fx);
+		(FizziksFloat4::load(fy) + Select4(inside, forceY)).store(fy);
+	};
+
+	int i = begin;
+	for (; i + 4 <= end; i += 4)
+	{
+		batch(&grid.x[i], &grid.y[i], &grid.vx[i], &grid.vy[i], &grid.mass[i], &fieldForceX[i], &fieldForceY[i]);
+	}
+
+	// Leftovers go through the same code, padded out to 4 with circles that are far away
+	int leftover = end - i;
+	if (leftover > 0)
+	{
+		float x[4] = { 1e15f, 1e15f, 1e15f, 1e15f }, y[4] = { 1e15f, 1e15f, 1e15f, 1e15f };
+		float vx[4] = {}, vy[4] = {}, m[4] = {}, fx[4] = {}, fy[4] = {};
+		for (int k = 0; k < leftover; k++)
+		{
+			x[k] = grid.x[i + k];
+			y[k] = grid.y[i + k];
+			vx[k] = grid.vx[i + k];
+			vy[k] = grid.vy[i + k];
+			m[k] = grid.mass[i + k];
+		}
+		batch(x, y, vx, vy, m, fx, fy);
+		for (int k = 0; k < leftover; k++)
+		{
+			fieldForceX[i + k] += fx[k];
+			fieldForceY[i + k] += fy[k];
+		}
+	}
+}
+
+void FizziksWorld::addForceFieldForces()
+{
+	int n = grid.size();
+	if (forceFields.empty() || n == 0) return;
+
+	fieldForceX.assign(n, 0);
+	fieldForceY.assign(n, 0);
+
+	for (int f = 0; f < forceFields.size(); f++)
+	{
+		const FizziksForceField& field = forceFields[f];
+
+		if (field.radius <= 0)
+		{
+			threads.parallelFor(n, 2048, [&](int begin, int end)
+			{
+				applyForceField(field, begin, end);
+			});
+			continue;
+		}
+
+		// Only the cells under the field's bounding box. Each row of cells is one run of grid slots,
+		// and different rows never share slots, so rows can go to different threads
+		int firstColumn = grid.cellColumn(field.position.x - field.radius);
+		int lastColumn = grid.cellColumn(field.position.x + field.radius);
+		int firstRow = grid.cellRow(field.position.y - field.radius);
+		int lastRow = grid.cellRow(field.position.y + field.radius);
+		threads.parallelFor(lastRow - firstRow + 1, 4, [&](int begin, int end)
+		{
+			for (int row = firstRow + begin; row < firstRow + end; row++)
+			{
+				applyForceField(field, grid.cellStart[row * grid.columns + firstColumn], grid.cellStart[row * grid.columns + lastColumn + 1]);
+			}
+		});
+	}
+
+	threads.parallelFor(n, 4096, [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			grid.circles[i]->netForce += Vector2{ fieldForceX[i], fieldForceY[i] };
+		}
+	});
+}
+
+void FizziksWorld::addFluidForces()
+{
+	if (grid.fluidCount == 0) return;
+
+	int n = grid.size();
+	fluidDensity.resize(n);
+	fluidInverseDensity.resize(n);
+	fluidPressureTerm.resize(n);
+
+	const float h = fluid.smoothingRadius;
+	const float h2 = h * h;
+	const float h5 = h2 * h2 * h;
+	const float poly6 = 4.0f / (PI * h2 * h2 * h2 * h2); // density kernel:  poly6 * (h^2 - r^2)^3
+	const float spiky = 30.0f / (PI * h5); // pressure kernel gradient:  -spiky * (h - r)^2 in the direction of r
+	const float viscosityLaplacian = 40.0f / (PI * h5); // viscosity kernel:  viscosityLaplacian * (h - r)
+
+	const float* x = grid.x.data();
+	const float* y = grid.y.data();
+	const float* vx = grid.vx.data();
+	const float* vy = grid.vy.data();
+	const float* fluidMass = grid.fluidMass.data();
+
+	// Pass 1: density and pressure of every fluid particle
+	threads.parallelFor(n, 512, [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			if (fluidMass[i] == 0)
+			{
+				fluidDensity[i] = fluid.restDensity; // Not fluid, never divided by but keep it sane
+				fluidInverseDensity[i] = 1.0f / fluid.restDensity;
+				fluidPressureTerm[i] = 0;
+				continue;
+			}
+
+			FizziksFloat4 xi = x[i], yi = y[i], h2v = h2, zero = 0.0f;
+			FizziksFloat4 sum4;
+			float sum = 0;
+
+			int begins[3], ends[3];
+			int rangeCount = grid.neighbourRanges(x[i], y[i], begins, ends);
+			for (int range = 0; range < rangeCount; range++)
+			{
+				int j = begins[range];
+				for (; j + 4 <= ends[range]; j += 4)
+				{
+					FizziksFloat4 dx = FizziksFloat4::load(x + j) - xi;
+					FizziksFloat4 dy = FizziksFloat4::load(y + j) - yi;
+					FizziksFloat4 t = Max4(h2v - (dx * dx + dy * dy), zero); // 0 outside the smoothing radius
+					sum4 = sum4 + FizziksFloat4::load(fluidMass + j) * t * t * t;
+				}
+				for (; j < ends[range]; j++)
+				{
+					float dx = x[j] - x[i];
+					float dy = y[j] - y[i];
+					float t = h2 - (dx * dx + dy * dy);
+					if (t > 0) sum += fluidMass[j] * t * t * t;
+				}
+			}
+
+			float density = poly6 * (sum + Sum4(sum4)); // Always includes the particle itself, so never 0
+			float pressure = fluid.stiffness * (density - fluid.restDensity);
+			if (pressure < 0) pressure = 0; // Only push, pulling makes particles clump together
+
+			fluidDensity[i] = density;
+			fluidInverseDensity[i] = 1.0f / density;
+			fluidPressureTerm[i] = pressure / (density * density);
+		}
+	});
+
+	// Pass 2: pressure and viscosity forces. Each particle only writes its own netForce, so threads don't overlap
+	threads.parallelFor(n, 512, [&](int begin, int end)
+	{
+		const float* pressureTerm = fluidPressureTerm.data();
+		const float* inverseDensity = fluidInverseDensity.data();
+
+		for (int i = begin; i < end; i++)
+		{
+			if (fluidMass[i] == 0) continue;
+
+			FizziksFloat4 xi = x[i], yi = y[i], vxi = vx[i], vyi = vy[i];
+			FizziksFloat4 pressureTermI = pressureTerm[i];
+			FizziksFloat4 hv = h, h2v = h2, tiny = 0.0001f;
+			FizziksFloat4 spikyV = spiky, viscosityV = fluid.viscosity * viscosityLaplacian;
+			FizziksFloat4 ax4, ay4;
+			float ax = 0, ay = 0;
+
+			int begins[3], ends[3];
+			int rangeCount = grid.neighbourRanges(x[i], y[i], begins, ends);
+			for (int range = 0; range < rangeCount; range++)
+			{
+				int j = begins[range];
+				for (; j + 4 <= ends[range]; j += 4)
+				{
+					// Displacement from j to i, pressure pushes i along it
+					FizziksFloat4 dx = xi - FizziksFloat4::load(x + j);
+					FizziksFloat4 dy = yi - FizziksFloat4::load(y + j);
+					FizziksFloat4 r2 = dx * dx + dy * dy;
+					FizziksFloat4 inside = And4(LessThan4(r2, h2v), LessThan4(tiny, r2)); // In range and not itself
+					FizziksFloat4 r = Sqrt4(Max4(r2, tiny));
+					FizziksFloat4 hr = Max4(hv - r, 0.0f);
+					FizziksFloat4 m = FizziksFloat4::load(fluidMass + j);
+
+					FizziksFloat4 pressureScale = m * (pressureTermI + FizziksFloat4::load(pressureTerm + j)) * spikyV * hr * hr / r;
+					FizziksFloat4 viscosityScale = m * FizziksFloat4::load(inverseDensity + j) * viscosityV * hr;
+
+					ax4 = ax4 + Select4(inside, pressureScale * dx + viscosityScale * (FizziksFloat4::load(vx + j) - vxi));
+					ay4 = ay4 + Select4(inside, pressureScale * dy + viscosityScale * (FizziksFloat4::load(vy + j) - vyi));
+				}
+				for (; j < ends[range]; j++)
+				{
+					float dx = x[i] - x[j];
+					float dy = y[i] - y[j];
+					float r2 = dx * dx + dy * dy;
+					if (r2 >= h2 || r2 <= 0.0001f) continue;
+
+					float r = sqrtf(r2);
+					float hr = h - r;
+					float pressureScale = fluidMass[j] * (pressureTerm[i] + pressureTerm[j]) * spiky * hr * hr / r;
+					float viscosityScale = fluidMass[j] * inverseDensity[j] * fluid.viscosity * viscosityLaplacian * hr;
+					ax += pressureScale * dx + viscosityScale * (vx[j] - vx[i]);
+					ay += pressureScale * dy + viscosityScale * (vy[j] - vy[i]);
+				}
+			}
+
+			// F = ma
+			Vector2 acceleration = { ax + Sum4(ax4), ay + Sum4(ay4) };
+			grid.circles[i]->netForce += acceleration * fluidMass[i];
+		}
+	});
+}
+
+void FizziksWorld::checkCollisions()
+{
+	//Start by painting everything green. When they touch they will be turned red and stay that way
+	//(fluid keeps its own colour, it's always touching something)
+	std::vector<FizziksHalfspace*> halfspaces;
+	for (int i = 0; i < objekts.size(); i++)
+	{
+		FizziksObjekt* objekt = objekts[i];
+		if (objekt->Shape() == HALF_SPACE) halfspaces.push_back((FizziksHalfspace*)objekt);
+		if (objekt->Shape() == CIRCLE && ((FizziksCircle*)objekt)->isFluid) continue;
+		objekt->color = GREEN;
+	}
+
+	//Halfspaces go on forever, so every circle has to be checked against every halfspace
+	for (int h = 0; h < halfspaces.size(); h++)
+	{
+		for (int i = 0; i < grid.size(); i++)
+		{
+			FizziksCircle* circle = grid.circles[i];
+			if (CircleHalfspaceCollisionResponse(circle, halfspaces[h], this))
+			{
+				halfspaces[h]->color = RED;
+				if (!circle->isFluid)
+				{
+					circle->color = RED;
+					continue;
+				}
+
+				// Water doesn't bounce off walls: stop it moving into the surface, or pressure keeps pumping energy in
+				Vector2 normal = halfspaces[h]->getNormal();
+				float speedIntoSurface = Vector2DotProduct(circle->velocity, normal);
+				if (speedIntoSurface < 0) circle->velocity -= normal * speedIntoSurface;
+			}
+		}
+	}
+
+	//Circles can only touch circles in the same or a neighbouring cell of the grid
+	for (int i = 0; i < grid.size(); i++)
+	{
+		int begins[3], ends[3];
+		int rangeCount = grid.neighbourRanges(grid.x[i], grid.y[i], begins, ends);
+		for (int range = 0; range < rangeCount; range++)
+		{
+			//j > i so each pair is only checked once
+			for (int j = (begins[range] > i + 1 ? begins[range] : i + 1); j < ends[range]; j++)
+			{
+				FizziksCircle* circleA = grid.circles[i];
+				FizziksCircle* circleB = grid.circles[j];
+
+				if (circleA->isFluid && circleB->isFluid) continue; // Fluid pressure keeps fluid apart
+
+				if (CircleCircleCollisionResponse(circleA, circleB))
+				{
+					if (!circleA->isFluid) circleA->color = RED;
+					if (!circleB->isFluid) circleB->color = RED;
+				}
+			}
+		}
+	}
+}
+
+/// 
+/// Collision Response Functions
+/// 
+
+bool CircleCircleOverlap(FizziksCircle* circleA, FizziksCircle* circleB) // returns true if circles are overlapping
+{
+	Vector2 displacementFromAToB = circleB->position - circleA->position;
+	float distance = Vector2Length(displacementFromAToB); //Use pythagorean theorem to get magnitude of displacement vector between circles to get a distance
+	float sumOfRadii = circleA->radius + circleB->radius;
+
+	if (sumOfRadii > distance)
+	{
+		return true; //overlapping
+	}
+	else
+		return false; // not overlapping
+}
+
+bool CircleCircleCollisionResponse(FizziksCircle* circleA, FizziksCircle* circleB) // returns true if circles are overlapping
+{
+	Vector2 displacementFromAToB = circleB->position - circleA->position;
+	float distance = Vector2Length(displacementFromAToB); //Use pythagorean theorem to get magnitude of displacement vector between circles to get a distance
+	float sumOfRadii = circleA->radius + circleB->radius;
+	float overlab = sumOfRadii - distance;
+	if (overlab > 0)
+	{
+		Vector2 normalAtoB;
+		if (abs(distance) < 0.0001f)
+			normalAtoB = { 0, 1 };
+		else
+			normalAtoB = (displacementFromAToB / distance);
+
+		Vector2 mtv = normalAtoB * overlab; // miniumum translation vector. Shortest distance
+
+		circleA->position -= mtv * 0.5f;
+		circleB->position += mtv * 0.5f;
+		return true; //overlapping
+	}
+	else
+		return false; // not overlapping
+}
+
+// Moves overlapping circles apart without any forces, lighter circles move further and static ones not at all.
+// Returns true if they were overlapping
+bool CircleCirclePushOut(FizziksCircle* circleA, FizziksCircle* circleB)
+{
+	Vector2 displacementFromAToB = circleB->position - circleA->position;
+	float distance = Vector2Length(displacementFromAToB);
+	float overlap = circleA->radius + circleB->radius - distance;
+	if (overlap <= 0) return false;
+
+	float wA = InverseMass(circleA);
+	float wB = InverseMass(circleB);
+	if (wA + wB <= 0) return true; // Both static
+
+	Vector2 normalAtoB = distance < 0.0001f ? Vector2{ 0, 1 } : displacementFromAToB / distance;
+	Vector2 mtv = normalAtoB * (overlap / (wA + wB)); // minimum translation vector, per unit of inverse mass
+
+	circleA->position -= mtv * wA;
+	circleB->position += mtv * wB;
+	return true;
+}
+
+// Returns true if the circle overlaps the halfspace, false otherwise
+bool CircleHalfspaceCollisionResponse(FizziksCircle* circle, FizziksHalfspace* halfspace, FizziksWorld* world) // returns true if circles are overlapping
+{
+	Vector2 displacementToCircle = circle->position - halfspace->position;
+	float dot = Vector2DotProduct(displacementToCircle, halfspace->getNormal());
+	Vector2 projectionDisplacementOntoNormal = halfspace->getNormal() * dot;
+
+	//DrawLineEx(circle->position, circle->position - projectionDisplacementOntoNormal, 1, GRAY);
+	//Vector2 midpoint = circle->position - projectionDisplacementOntoNormal * 0.5f;
+	//DrawText(TextFormat("D: %6.0f", dot), midpoint.x, midpoint.y, 30, GRAY);
+
+	float overlap = circle->radius - dot;
+
+	if (overlap > 0)
+	{
+		// Move!
+		CircleHalfspacePushOut(circle, halfspace);
+
+		// Get Gravity Force
+		Vector2 Fgravity = world->accelerationGravity * circle->mass;
+
+		// Apply normal force
+		Vector2 FgPerp = halfspace->getNormal() * Vector2DotProduct(Fgravity, halfspace->getNormal());
+		Vector2 Fnormal = FgPerp * -1;
+		circle->netForce += Fnormal;
+		world->addDebugLine(circle->position, circle->position + Fnormal, 1, GREEN);
+
+		// Friction 
+		// F = uN where u is coefficient of friction between 2 surfaces
+		// F is the max Magnitube of force of friction
+		// N is the magnitude of the normal force
+		float u = circle->grippiness * halfspace->grippiness;
+		float frictionMagnitude = u * Vector2Length(Fnormal);
+
+		// The Direction of friction = opposite other applied forces in the surface plane
+		Vector2 FgPara = Fgravity - FgPerp;
+		Vector2 frictionDirection = Vector2Normalize(FgPara) * -1;
+
+		Vector2 Ffriction = frictionDirection * frictionMagnitude;
+
+		float frictionForceLength = Vector2Length(Ffriction);
+
+		circle->netForce += Ffriction;
+		world->addDebugLine(circle->position, circle->position + Fnormal, 2, ORANGE);
+
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+// Moves the circle out of the halfspace along its normal, without any forces. Returns true if they were overlapping
+bool CircleHalfspacePushOut(FizziksCircle* circle, FizziksHalfspace* halfspace)
+{
+	Vector2 displacementToCircle = circle->position - halfspace->position;
+	float overlap = circle->radius - Vector2DotProduct(displacementToCircle, halfspace->getNormal());
+
+	if (overlap > 0)
+	{
+		Vector2 mtv = halfspace->getNormal() * overlap; // miniumum translation vector
+		circle->position += mtv;
+		return true;
+	}
+	return false;
+}
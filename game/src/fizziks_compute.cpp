@@ -0,0 +1,634 @@
+#include "fizziks_compute.h"
+#include "rlgl.h"
+#include <cmath>
+#include <string>
+
+static_assert(sizeof(FizziksComputeBody) == 32, "FizziksComputeBody must match the std430 Body struct in the shaders");
+static_assert(sizeof(FizziksComputeHalfspace) == 32, "FizziksComputeHalfspace must match the std430 Halfspace struct in the shaders");
+
+const int COMPUTE_GROUP_SIZE = 64; // local_size_x of every kernel below
+
+///
+/// Shaders
+///
+
+// Shared by the three kernels: the buffers, the settings and the grid lookup
+static const char* COMPUTE_COMMON = R"(#version 430
+layout(local_size_x = 64) in;
+
+struct Body
+{
+    vec2 position;
+    vec2 velocity;
+    float radius;
+    uint flags;
+    uint color;
+    float grippiness;
+};
+
+struct Halfspace
+{
+    vec2 point;
+    vec2 normal;
+    float grippiness;
+    uint touched;
+    vec2 padding;
+};
+
+layout(std430, binding = 0) buffer BodiesIn { Body bodiesIn[]; };
+layout(std430, binding = 1) buffer BodiesOut { Body bodiesOut[]; };
+layout(std430, binding = 2) buffer CellCounts { uint cellCounts[]; };
+layout(std430, binding = 3) buffer CellBodies { uint cellBodies[]; };
+layout(std430, binding = 4) buffer Halfspaces { Halfspace halfspaces[]; };
+layout(std430, binding = 5) buffer Counters { uint overflowCount; };
+
+uniform vec2 gridOrigin;
+uniform float cellSize;
+uniform ivec2 gridSize;     // columns, rows
+uniform int cellCapacity;
+uniform int bodyCount;
+uniform int halfspaceCount;
+uniform vec2 gravity;
+uniform float dt;
+uniform int integrator;     // 0 = explicit Euler, 1 = symplectic Euler
+
+const uint STATIC = 1u;
+const uint TOUCHING = 2u;
+const uint RED_COLOR = 0xFF3729E6u;     // raylib RED (230, 41, 55, 255) as it sits in memory
+const uint GREEN_COLOR = 0xFF30E400u;   // raylib GREEN (0, 228, 48, 255)
+
+ivec2 cellOf(vec2 position)
+{
+    ivec2 cell = ivec2((position - gridOrigin)/cellSize);
+    return clamp(cell, ivec2(0), gridSize - 1);
+}
+)";
+
+// Empties the grid and the halfspaces' touched flags
+static const char* CLEAR_KERNEL = R"(
+void main()
+{
+    uint i = gl_GlobalInvocationID.x;
+    if (i < uint(gridSize.x*gridSize.y)) cellCounts[i] = 0u;
+    if (i < uint(halfspaceCount)) halfspaces[i].touched = 0u;
+}
+)";
+
+// Every body takes the next free slot of its cell
+static const char* BIN_KERNEL = R"(
+void main()
+{
+    uint i = gl_GlobalInvocationID.x;
+    if (i >= uint(bodyCount)) return;
+
+    ivec2 cell = cellOf(bodiesIn[i].position);
+    uint cellIndex = uint(cell.y*gridSize.x + cell.x);
+    uint slot = atomicAdd(cellCounts[cellIndex], 1u);
+    if (slot < uint(cellCapacity)) cellBodies[cellIndex*uint(cellCapacity) + slot] = i;
+    else atomicAdd(overflowCount, 1u);
+}
+)";
+
+// Halfspaces, then circles (old positions only), then integration. See FizziksComputeSolver::stepReference for the same in C++
+static const char* STEP_KERNEL = R"(
+void main()
+{
+    uint i = gl_GlobalInvocationID.x;
+    if (i >= uint(bodyCount)) return;
+
+    Body body = bodiesIn[i];
+    vec2 position = body.position;
+    vec2 velocity = body.velocity;
+    vec2 acceleration = gravity;
+    bool touching = false;
+
+    // Push out of halfspaces, add normal force and friction (CircleHalfspaceCollisionResponse, per unit mass)
+    for (int h = 0; h < halfspaceCount; h++)
+    {
+        Halfspace halfspace = halfspaces[h];
+        float overlap = body.radius - dot(position - halfspace.point, halfspace.normal);
+        if (overlap <= 0.0) continue;
+
+        position += halfspace.normal*overlap;
+
+        vec2 gravityPerpendicular = halfspace.normal*dot(gravity, halfspace.normal);
+        vec2 normalAcceleration = -gravityPerpendicular;
+        float frictionMagnitude = body.grippiness*halfspace.grippiness*length(normalAcceleration);
+        vec2 gravityParallel = gravity - gravityPerpendicular;
+        vec2 frictionDirection = (length(gravityParallel) > 0.0)? -normalize(gravityParallel) : vec2(0.0);
+        acceleration += normalAcceleration + frictionDirection*frictionMagnitude;
+
+        halfspaces[h].touched = 1u;
+        touching = true;
+    }
+
+    // Move half the overlap away from every circle touching this one (CircleCircleCollisionResponse)
+    ivec2 cell = cellOf(body.position);
+    vec2 push = vec2(0.0);
+    for (int row = max(cell.y - 1, 0); row <= min(cell.y + 1, gridSize.y - 1); row++)
+    {
+        for (int column = max(cell.x - 1, 0); column <= min(cell.x + 1, gridSize.x - 1); column++)
+        {
+            uint cellIndex = uint(row*gridSize.x + column);
+            uint count = min(cellCounts[cellIndex], uint(cellCapacity));
+            for (uint k = 0u; k < count; k++)
+            {
+                uint j = cellBodies[cellIndex*uint(cellCapacity) + k];
+                if (j == i) continue;
+
+                Body other = bodiesIn[j];
+                vec2 displacement = other.position - body.position;
+                float distance = length(displacement);
+                float overlap = body.radius + other.radius - distance;
+                if (overlap <= 0.0) continue;
+
+                // Circles exactly on top of each other: lower index goes up, higher goes down
+                vec2 normal = (distance < 0.0001)? ((i < j)? vec2(0.0, 1.0) : vec2(0.0, -1.0)) : displacement/distance;
+                push -= normal*(overlap*0.5);
+                touching = true;
+            }
+        }
+    }
+    position += push;
+
+    if ((body.flags & STATIC) == 0u)
+    {
+        if (integrator == 0)
+        {
+            position += velocity*dt;
+            velocity += acceleration*dt;
+        }
+        else
+        {
+            velocity += acceleration*dt;
+            position += velocity*dt;
+        }
+    }
+
+    body.position = position;
+    body.velocity = velocity;
+    body.flags = touching? (body.flags | TOUCHING) : (body.flags & ~TOUCHING);
+    body.color = touching? RED_COLOR : GREEN_COLOR;
+    bodiesOut[i] = body;
+}
+)";
+
+// One quad per body, positions read straight from the body buffer
+static const char* DRAW_VERTEX_SHADER = R"(#version 430
+struct Body
+{
+    vec2 position;
+    vec2 velocity;
+    float radius;
+    uint flags;
+    uint color;
+    float grippiness;
+};
+
+layout(std430, binding = 0) readonly buffer Bodies { Body bodies[]; };
+
+uniform mat4 mvp;
+
+out vec2 local;
+out float radius;
+out vec4 discColor;
+
+// Counter-clockwise on screen, like raylib's own quads, or back face culling throws them away
+const vec2 corners[6] = vec2[](vec2(-1.0, -1.0), vec2(-1.0, 1.0), vec2(1.0, 1.0), vec2(-1.0, -1.0), vec2(1.0, 1.0), vec2(1.0, -1.0));
+
+void main()
+{
+    Body body = bodies[gl_InstanceID];
+    radius = body.radius;
+    local = corners[gl_VertexID]*(body.radius + 1.0);
+    discColor = unpackUnorm4x8(body.color);
+    gl_Position = mvp*vec4(body.position + local, 0.0, 1.0);
+}
+)";
+
+// Anti-aliased disc: alpha fades over one pixel around the edge
+static const char* DRAW_FRAGMENT_SHADER = R"(#version 430
+in vec2 local;
+in float radius;
+in vec4 discColor;
+
+out vec4 finalColor;
+
+void main()
+{
+    float dist = length(local) - radius;
+    float pixelSize = max(length(vec2(dFdx(local.x), dFdy(local.x))), 0.0001);
+    float alpha = clamp(0.5 - dist/pixelSize, 0.0, 1.0);
+    if (alpha <= 0.0) discard;
+
+    finalColor = vec4(discColor.rgb, discColor.a*alpha);
+}
+)";
+
+static unsigned int LoadComputeKernel(const char* kernel)
+{
+	std::string code = std::string(COMPUTE_COMMON) + kernel;
+	unsigned int shader = rlCompileShader(code.c_str(), RL_COMPUTE_SHADER);
+	if (shader == 0) return 0;
+	return rlLoadComputeShaderProgram(shader);
+}
+
+///
+/// Solver
+///
+
+bool FizziksComputeSolver::load()
+{
+	unload();
+
+	// Compute shaders and SSBOs are OpenGL 4.3. Like the rest of fizziks this never logs, rlgl reports what failed
+	if (rlGetVersion() != RL_OPENGL_43) return false;
+
+	clearProgram = LoadComputeKernel(CLEAR_KERNEL);
+	binProgram = LoadComputeKernel(BIN_KERNEL);
+	stepProgram = LoadComputeKernel(STEP_KERNEL);
+	drawProgram = rlLoadShaderCode(DRAW_VERTEX_SHADER, DRAW_FRAGMENT_SHADER);
+	if (drawProgram == rlGetShaderIdDefault()) drawProgram = 0; // rlgl hands back its default shader when linking fails
+
+	if (clearProgram == 0 || binProgram == 0 || stepProgram == 0 || drawProgram == 0)
+	{
+		loaded = true; // So unload() frees whatever did load
+		unload();
+		return false;
+	}
+	drawMvpLocation = rlGetLocationUniform(drawProgram, "mvp");
+	emptyVertexArray = rlLoadVertexArray();
+
+	// Buffers never have size 0, so every binding point always has something bound
+	unsigned int zero = 0;
+	counterBuffer = rlLoadShaderBuffer(sizeof(unsigned int), &zero, RL_DYNAMIC_COPY);
+	halfspaceBuffer = rlLoadShaderBuffer(sizeof(FizziksComputeHalfspace), nullptr, RL_DYNAMIC_COPY);
+	halfspaceCapacity = 1;
+
+	loaded = true;
+	return true;
+}
+
+void FizziksComputeSolver::unload()
+{
+	if (loaded)
+	{
+		if (clearProgram != 0) rlUnloadShaderProgram(clearProgram);
+		if (binProgram != 0) rlUnloadShaderProgram(binProgram);
+		if (stepProgram != 0) rlUnloadShaderProgram(stepProgram);
+		if (drawProgram != 0) rlUnloadShaderProgram(drawProgram);
+		if (emptyVertexArray != 0) rlUnloadVertexArray(emptyVertexArray);
+		for (unsigned int buffer : { bodyBuffers[0], bodyBuffers[1], halfspaceBuffer, cellCountBuffer, cellBodyBuffer, counterBuffer })
+		{
+			if (buffer != 0) rlUnloadShaderBuffer(buffer);
+		}
+	}
+
+	loaded = false;
+	clearProgram = binProgram = stepProgram = drawProgram = 0;
+	drawMvpLocation = -1;
+	emptyVertexArray = 0;
+	bodyBuffers[0] = bodyBuffers[1] = 0;
+	currentBodies = 0;
+	bodyCapacity = 0;
+	halfspaceBuffer = cellCountBuffer = cellBodyBuffer = counterBuffer = 0;
+	halfspaceCapacity = 0;
+	cellCapacityLoaded = 0;
+}
+
+bool FizziksComputeSolver::canSimulate(const FizziksWorld& world) const
+{
+	if (!loaded) return false;
+	if (!world.constraints.empty() || !world.forceFields.empty() || world.mutualGravity.enabled) return false;
+	if (world.integrator != EXPLICIT_EULER && world.integrator != SYMPLECTIC_EULER) return false;
+
+	for (FizziksObjekt* objekt : world.objekts)
+	{
+		if (objekt->Shape() == CIRCLE && ((FizziksCircle*)objekt)->isFluid) return false;
+	}
+	return true;
+}
+
+void FizziksComputeSolver::upload(const FizziksWorld& world)
+{
+	bodies.clear();
+	circles.clear();
+	halfspaces.clear();
+	halfspaceObjekts.clear();
+
+	for (FizziksObjekt* objekt : world.objekts)
+	{
+		if (objekt->Shape() == CIRCLE)
+		{
+			FizziksCircle* circle = (FizziksCircle*)objekt;
+			FizziksComputeBody body;
+			body.position = circle->position;
+			body.velocity = circle->velocity;
+			body.radius = circle->radius;
+			body.flags = circle->isStatic ? FIZZIKS_COMPUTE_STATIC : 0;
+			body.color = circle->color;
+			body.grippiness = circle->grippiness;
+			bodies.push_back(body);
+			circles.push_back(circle);
+		}
+		else if (objekt->Shape() == HALF_SPACE)
+		{
+			FizziksHalfspace* halfspace = (FizziksHalfspace*)objekt;
+			FizziksComputeHalfspace gpuHalfspace = {};
+			gpuHalfspace.point = halfspace->position;
+			gpuHalfspace.normal = halfspace->getNormal();
+			gpuHalfspace.grippiness = halfspace->grippiness;
+			halfspaces.push_back(gpuHalfspace);
+			halfspaceObjekts.push_back(halfspace);
+		}
+	}
+
+	gravity = world.accelerationGravity;
+	integrator = world.integrator;
+	uploadBodies();
+}
+
+void FizziksComputeSolver::uploadBodies()
+{
+	int n = (int)bodies.size();
+
+	// Grid: cells as big as the biggest circle, but never more than ~4 cells per circle (like FizziksCircleGrid)
+	Vector2 boundsMin = { 0,0 };
+	Vector2 boundsMax = { 0,0 };
+	float maxRadius = 0.5f;
+	float minRadius = 1e30f;
+	if (n > 0) boundsMin = boundsMax = bodies[0].position;
+	for (const FizziksComputeBody& body : bodies)
+	{
+		boundsMin = Vector2Min(boundsMin, body.position);
+		boundsMax = Vector2Max(boundsMax, body.position);
+		if (body.radius > maxRadius) maxRadius = body.radius;
+		if (body.radius < minRadius) minRadius = body.radius;
+	}
+	if (minRadius < 0.5f) minRadius = 0.5f;
+
+	grid.origin = boundsMin;
+	grid.cellSize = maxRadius * 2;
+	while (true)
+	{
+		grid.columns = (int)((boundsMax.x - boundsMin.x) / grid.cellSize) + 1;
+		grid.rows = (int)((boundsMax.y - boundsMin.y) / grid.cellSize) + 1;
+		if ((long long)grid.columns * grid.rows <= 4LL * n + 64) break;
+		grid.cellSize *= 2;
+	}
+
+	// Enough slots for the smallest circles packed edge to edge across the cell, and for twice the fullest cell
+	// right now (piles that overlap a lot hold more than packing says), within reason
+	float circlesAcross = grid.cellSize / (2 * minRadius) + 1;
+	int capacity = (int)ceilf(circlesAcross * circlesAcross);
+	if (capacity > 64) capacity = 64;
+	std::vector<int> cellCounts(grid.cellCount(), 0);
+	int fullestCell = 0;
+	for (const FizziksComputeBody& body : bodies)
+	{
+		int count = ++cellCounts[grid.cellOf(body.position)];
+		if (count > fullestCell) fullestCell = count;
+	}
+	if (fullestCell * 2 > capacity) capacity = fullestCell * 2;
+	grid.cellCapacity = capacity < 8 ? 8 : (capacity > 256 ? 256 : capacity);
+
+	if (!loaded || n == 0) return;
+
+	// Grow buffers to the next power of two, so a few circles being added doesn't reallocate every frame
+	if (n > bodyCapacity)
+	{
+		int newCapacity = bodyCapacity > 0 ? bodyCapacity : 256;
+		while (newCapacity < n) newCapacity *= 2;
+		for (unsigned int& buffer : bodyBuffers)
+		{
+			if (buffer != 0) rlUnloadShaderBuffer(buffer);
+			buffer = rlLoadShaderBuffer(newCapacity * sizeof(FizziksComputeBody), nullptr, RL_DYNAMIC_COPY);
+		}
+		bodyCapacity = newCapacity;
+	}
+	currentBodies = 0;
+	rlUpdateShaderBuffer(bodyBuffers[0], bodies.data(), n * sizeof(FizziksComputeBody), 0);
+
+	int slots = grid.cellCount() * grid.cellCapacity;
+	if (slots > cellCapacityLoaded)
+	{
+		int newSlots = cellCapacityLoaded > 0 ? cellCapacityLoaded : 4096;
+		while (newSlots < slots) newSlots *= 2;
+		if (cellCountBuffer != 0) rlUnloadShaderBuffer(cellCountBuffer);
+		if (cellBodyBuffer != 0) rlUnloadShaderBuffer(cellBodyBuffer);
+		// Counts need one entry per cell, and there are at least 8 slots per cell
+		cellCountBuffer = rlLoadShaderBuffer(newSlots / 8 * sizeof(unsigned int), nullptr, RL_DYNAMIC_COPY);
+		cellBodyBuffer = rlLoadShaderBuffer(newSlots * sizeof(unsigned int), nullptr, RL_DYNAMIC_COPY);
+		cellCapacityLoaded = newSlots;
+	}
+
+	int halfspaceCount = (int)halfspaces.size();
+	if (halfspaceCount > halfspaceCapacity)
+	{
+		rlUnloadShaderBuffer(halfspaceBuffer);
+		halfspaceBuffer = rlLoadShaderBuffer(halfspaceCount * sizeof(FizziksComputeHalfspace), nullptr, RL_DYNAMIC_COPY);
+		halfspaceCapacity = halfspaceCount;
+	}
+	if (halfspaceCount > 0) rlUpdateShaderBuffer(halfspaceBuffer, halfspaces.data(), halfspaceCount * sizeof(FizziksComputeHalfspace), 0);
+
+	unsigned int zero = 0;
+	rlUpdateShaderBuffer(counterBuffer, &zero, sizeof(zero), 0);
+}
+
+void FizziksComputeSolver::setGridUniforms(unsigned int program, float dt)
+{
+	int bodyCount = (int)bodies.size();
+	int halfspaceCount = (int)halfspaces.size();
+	int gridSize[2] = { grid.columns, grid.rows };
+	int integratorIndex = (integrator == EXPLICIT_EULER) ? 0 : 1;
+
+	rlSetUniform(rlGetLocationUniform(program, "gridOrigin"), &grid.origin, RL_SHADER_UNIFORM_VEC2, 1);
+	rlSetUniform(rlGetLocationUniform(program, "cellSize"), &grid.cellSize, RL_SHADER_UNIFORM_FLOAT, 1);
+	rlSetUniform(rlGetLocationUniform(program, "gridSize"), gridSize, RL_SHADER_UNIFORM_IVEC2, 1);
+	rlSetUniform(rlGetLocationUniform(program, "cellCapacity"), &grid.cellCapacity, RL_SHADER_UNIFORM_INT, 1);
+	rlSetUniform(rlGetLocationUniform(program, "bodyCount"), &bodyCount, RL_SHADER_UNIFORM_INT, 1);
+	rlSetUniform(rlGetLocationUniform(program, "halfspaceCount"), &halfspaceCount, RL_SHADER_UNIFORM_INT, 1);
+	rlSetUniform(rlGetLocationUniform(program, "gravity"), &gravity, RL_SHADER_UNIFORM_VEC2, 1);
+	rlSetUniform(rlGetLocationUniform(program, "dt"), &dt, RL_SHADER_UNIFORM_FLOAT, 1);
+	rlSetUniform(rlGetLocationUniform(program, "integrator"), &integratorIndex, RL_SHADER_UNIFORM_INT, 1);
+}
+
+void FizziksComputeSolver::step(float dt)
+{
+	if (!loaded || bodies.empty()) return;
+
+	int n = (int)bodies.size();
+	int clearCount = grid.cellCount() > (int)halfspaces.size() ? grid.cellCount() : (int)halfspaces.size();
+
+	rlBindShaderBuffer(bodyBuffers[currentBodies], 0);
+	rlBindShaderBuffer(bodyBuffers[1 - currentBodies], 1);
+	rlBindShaderBuffer(cellCountBuffer, 2);
+	rlBindShaderBuffer(cellBodyBuffer, 3);
+	rlBindShaderBuffer(halfspaceBuffer, 4);
+	rlBindShaderBuffer(counterBuffer, 5);
+
+	// Each pass reads what the one before wrote, so wait for it with a barrier
+	rlEnableShader(clearProgram);
+	setGridUniforms(clearProgram, dt);
+	rlComputeShaderDispatch((clearCount + COMPUTE_GROUP_SIZE - 1) / COMPUTE_GROUP_SIZE, 1, 1);
+	rlComputeShaderBarrier();
+
+	rlEnableShader(binProgram);
+	setGridUniforms(binProgram, dt);
+	rlComputeShaderDispatch((n + COMPUTE_GROUP_SIZE - 1) / COMPUTE_GROUP_SIZE, 1, 1);
+	rlComputeShaderBarrier();
+
+	rlEnableShader(stepProgram);
+	setGridUniforms(stepProgram, dt);
+	rlComputeShaderDispatch((n + COMPUTE_GROUP_SIZE - 1) / COMPUTE_GROUP_SIZE, 1, 1);
+	rlComputeShaderBarrier();
+
+	rlDisableShader();
+	currentBodies = 1 - currentBodies;
+}
+
+void FizziksComputeSolver::readBodies()
+{
+	if (!loaded || bodies.empty()) return;
+
+	rlReadShaderBuffer(bodyBuffers[currentBodies], bodies.data(), (unsigned int)(bodies.size() * sizeof(FizziksComputeBody)), 0);
+	if (!halfspaces.empty())
+	{
+		rlReadShaderBuffer(halfspaceBuffer, halfspaces.data(), (unsigned int)(halfspaces.size() * sizeof(FizziksComputeHalfspace)), 0);
+	}
+}
+
+void FizziksComputeSolver::download(FizziksWorld& world)
+{
+	readBodies();
+
+	// Same colours checkCollisions paints: green, red once touching
+	for (int i = 0; i < (int)bodies.size(); i++)
+	{
+		circles[i]->position = bodies[i].position;
+		circles[i]->velocity = bodies[i].velocity;
+		circles[i]->color = bodies[i].color;
+	}
+	for (int h = 0; h < (int)halfspaces.size(); h++)
+	{
+		halfspaceObjekts[h]->color = halfspaces[h].touched ? RED : GREEN;
+	}
+
+	world.debugLines.clear(); // The GPU doesn't record any
+}
+
+void FizziksComputeSolver::drawCircles()
+{
+	if (!loaded || bodies.empty()) return;
+
+	// Draw what raylib has batched so far first, so the circles go on top of it like DrawCircle would
+	rlDrawRenderBatchActive();
+
+	Matrix mvp = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+	rlEnableShader(drawProgram);
+	rlSetUniformMatrix(drawMvpLocation, mvp);
+	rlBindShaderBuffer(bodyBuffers[currentBodies], 0);
+	rlEnableVertexArray(emptyVertexArray);
+	rlDrawVertexArrayInstanced(0, 6, (int)bodies.size());
+	rlDisableVertexArray();
+	rlDisableShader();
+}
+
+unsigned int FizziksComputeSolver::overflowCount()
+{
+	unsigned int count = 0;
+	if (loaded) rlReadShaderBuffer(counterBuffer, &count, sizeof(count), 0);
+	return count;
+}
+
+void FizziksComputeSolver::stepReference(std::vector<FizziksComputeBody>& stepBodies, std::vector<FizziksComputeHalfspace>& stepHalfspaces, float dt) const
+{
+	int n = (int)stepBodies.size();
+	const std::vector<FizziksComputeBody> old = stepBodies; // Every circle sees the others where they were before the step
+
+	// clear + bin, in body order
+	std::vector<unsigned int> cellCounts(grid.cellCount(), 0);
+	std::vector<int> cellBodies(grid.cellCount() * grid.cellCapacity);
+	for (int i = 0; i < n; i++)
+	{
+		int cell = grid.cellOf(old[i].position);
+		unsigned int slot = cellCounts[cell]++;
+		if (slot < (unsigned int)grid.cellCapacity) cellBodies[cell * grid.cellCapacity + slot] = i;
+	}
+	for (FizziksComputeHalfspace& halfspace : stepHalfspaces) halfspace.touched = 0;
+
+	// step
+	for (int i = 0; i < n; i++)
+	{
+		FizziksComputeBody body = old[i];
+		Vector2 position = body.position;
+		Vector2 velocity = body.velocity;
+		Vector2 acceleration = gravity;
+		bool touching = false;
+
+		for (FizziksComputeHalfspace& halfspace : stepHalfspaces)
+		{
+			float overlap = body.radius - Vector2DotProduct(position - halfspace.point, halfspace.normal);
+			if (overlap <= 0) continue;
+
+			position += halfspace.normal * overlap;
+
+			Vector2 gravityPerpendicular = halfspace.normal * Vector2DotProduct(gravity, halfspace.normal);
+			Vector2 normalAcceleration = gravityPerpendicular * -1;
+			float frictionMagnitude = body.grippiness * halfspace.grippiness * Vector2Length(normalAcceleration);
+			Vector2 frictionDirection = Vector2Normalize(gravity - gravityPerpendicular) * -1;
+			acceleration += normalAcceleration + frictionDirection * frictionMagnitude;
+
+			halfspace.touched = 1;
+			touching = true;
+		}
+
+		int cell = grid.cellOf(body.position);
+		int column = cell % grid.columns;
+		int row = cell / grid.columns;
+		Vector2 push = { 0,0 };
+		for (int r = (row > 0 ? row - 1 : 0); r <= row + 1 && r < grid.rows; r++)
+		{
+			for (int c = (column > 0 ? column - 1 : 0); c <= column + 1 && c < grid.columns; c++)
+			{
+				int cellIndex = r * grid.columns + c;
+				unsigned int count = cellCounts[cellIndex] < (unsigned int)grid.cellCapacity ? cellCounts[cellIndex] : grid.cellCapacity;
+				for (unsigned int k = 0; k < count; k++)
+				{
+					int j = cellBodies[cellIndex * grid.cellCapacity + k];
+					if (j == i) continue;
+
+					Vector2 displacement = old[j].position - body.position;
+					float distance = Vector2Length(displacement);
+					float overlap = body.radius + old[j].radius - distance;
+					if (overlap <= 0) continue;
+
+					Vector2 normal = (distance < 0.0001f) ? Vector2{ 0, i < j ? 1.0f : -1.0f } : displacement / distance;
+					push -= normal * (overlap * 0.5f);
+					touching = true;
+				}
+			}
+		}
+		position += push;
+
+		if (!(body.flags & FIZZIKS_COMPUTE_STATIC))
+		{
+			if (integrator == EXPLICIT_EULER)
+			{
+				position += velocity * dt;
+				velocity += acceleration * dt;
+			}
+			else
+			{
+				velocity += acceleration * dt;
+				position += velocity * dt;
+			}
+		}
+
+		body.position = position;
+		body.velocity = velocity;
+		body.flags = touching ? (body.flags | FIZZIKS_COMPUTE_TOUCHING) : (body.flags & ~FIZZIKS_COMPUTE_TOUCHING);
+		body.color = touching ? RED : GREEN;
+		stepBodies[i] = body;
+	}
+}
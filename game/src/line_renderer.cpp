@@ -0,0 +1,177 @@
+#include "line_renderer.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <cstddef>
+
+static_assert(sizeof(LineInstance) == 24, "LineInstance is uploaded as is, the attribute layout below depends on it");
+
+// Attribute locations, the same ones the shaders ask for with layout(location = N)
+const int CORNER_ATTRIBUTE = 0;
+const int SEGMENT_ATTRIBUTE = 1;
+const int THICKNESS_ATTRIBUTE = 2;
+const int COLOR_ATTRIBUTE = 3;
+
+// Turns the quad corner into a point around the segment.
+// local is measured from the start of the line: x along the line, y across it. Units are the same as the
+// positions (pixels in this game). The quad is one unit bigger than the line on every side, for the anti-aliased edge
+static const char* LINE_VERTEX_SHADER = R"(#version 330
+layout(location = 0) in vec2 corner;       // x: 0 at the start end, 1 at the end end. y: -1/+1 for the two sides
+layout(location = 1) in vec4 segment;      // start.xy, end.xy
+layout(location = 2) in float thickness;
+layout(location = 3) in vec4 color;
+
+uniform mat4 mvp;
+
+out vec2 local;
+out float segmentLength;
+out float radius;
+out vec4 lineColor;
+
+void main()
+{
+    vec2 start = segment.xy;
+    vec2 delta = segment.zw - segment.xy;
+    segmentLength = length(delta);
+    vec2 along = (segmentLength > 0.0)? delta/segmentLength : vec2(1.0, 0.0);
+    vec2 across = vec2(-along.y, along.x);
+
+    radius = thickness*0.5;
+    float margin = radius + 1.0;
+    local = vec2(mix(-margin, segmentLength + margin, corner.x), corner.y*margin);
+    lineColor = color;
+
+    vec2 position = start + along*local.x + across*local.y;
+    gl_Position = mvp*vec4(position, 0.0, 1.0);
+}
+)";
+
+// Distance from the pixel to the segment, minus the radius: negative inside the line, positive outside.
+// Alpha fades from 1 to 0 over the pixel around distance 0
+static const char* LINE_FRAGMENT_SHADER = R"(#version 330
+in vec2 local;
+in float segmentLength;
+in float radius;
+in vec4 lineColor;
+
+out vec4 finalColor;
+
+void main()
+{
+    vec2 closest = vec2(clamp(local.x, 0.0, segmentLength), 0.0);
+    float dist = length(local - closest) - radius;
+
+    float pixelSize = max(length(vec2(dFdx(local.x), dFdy(local.x))), 0.0001);
+    float alpha = clamp(0.5 - dist/pixelSize, 0.0, 1.0);
+    if (alpha <= 0.0) discard;
+
+    finalColor = vec4(lineColor.rgb, lineColor.a*alpha);
+}
+)";
+
+void LineRenderer::load()
+{
+	sdfSupported = false;
+
+	// Instancing and GLSL 330 are only guaranteed on desktop OpenGL 3.3+
+	int version = rlGetVersion();
+	if (version != RL_OPENGL_33 && version != RL_OPENGL_43)
+	{
+		TraceLog(LOG_INFO, "LINES: OpenGL 3.3 not available, drawing lines with DrawLineEx");
+		return;
+	}
+
+	shader = LoadShaderFromMemory(LINE_VERTEX_SHADER, LINE_FRAGMENT_SHADER);
+	if (shader.id == 0 || shader.id == rlGetShaderIdDefault())
+	{
+		// raylib hands back its default shader when compiling fails
+		TraceLog(LOG_WARNING, "LINES: Shader failed, drawing lines with DrawLineEx");
+		shader = {};
+		return;
+	}
+	mvpLocation = GetShaderLocation(shader, "mvp");
+
+	vertexArray = rlLoadVertexArray();
+	rlEnableVertexArray(vertexArray);
+
+	// Two triangles covering the quad, counter-clockwise on screen like raylib's own quads, or back face culling throws them away
+	const float corners[12] = { 0, -1,  0, 1,  1, 1,   0, -1,  1, 1,  1, -1 };
+	cornerBuffer = rlLoadVertexBuffer(corners, sizeof(corners), false);
+	rlSetVertexAttribute(CORNER_ATTRIBUTE, 2, RL_FLOAT, false, 0, 0);
+	rlEnableVertexAttribute(CORNER_ATTRIBUTE);
+
+	loadInstanceBuffer(1024);
+
+	rlDisableVertexArray();
+	sdfSupported = true;
+}
+
+// (Re)creates the instance buffer and points the per-line attributes at it. The vertex array must be enabled
+void LineRenderer::loadInstanceBuffer(int capacity)
+{
+	if (instanceBuffer != 0) rlUnloadVertexBuffer(instanceBuffer);
+
+	instanceBuffer = rlLoadVertexBuffer(nullptr, capacity * sizeof(LineInstance), true);
+	instanceCapacity = capacity;
+
+	const int stride = sizeof(LineInstance);
+	rlSetVertexAttribute(SEGMENT_ATTRIBUTE, 4, RL_FLOAT, false, stride, offsetof(LineInstance, start));
+	rlSetVertexAttribute(THICKNESS_ATTRIBUTE, 1, RL_FLOAT, false, stride, offsetof(LineInstance, thickness));
+	rlSetVertexAttribute(COLOR_ATTRIBUTE, 4, RL_UNSIGNED_BYTE, true, stride, offsetof(LineInstance, color));
+
+	// Divisor 1: these attributes move forward once per line (instance), not once per corner
+	for (int attribute : { SEGMENT_ATTRIBUTE, THICKNESS_ATTRIBUTE, COLOR_ATTRIBUTE })
+	{
+		rlEnableVertexAttribute(attribute);
+		rlSetVertexAttributeDivisor(attribute, 1);
+	}
+}
+
+void LineRenderer::unload()
+{
+	if (sdfSupported)
+	{
+		rlUnloadVertexArray(vertexArray);
+		rlUnloadVertexBuffer(cornerBuffer);
+		rlUnloadVertexBuffer(instanceBuffer);
+		UnloadShader(shader);
+	}
+	sdfSupported = false;
+	vertexArray = cornerBuffer = instanceBuffer = 0;
+	instanceCapacity = 0;
+	shader = {};
+	lines.clear();
+}
+
+void LineRenderer::draw()
+{
+	if (lines.empty()) return;
+
+	if (!sdfSupported)
+	{
+		for (const LineInstance& line : lines) DrawLineEx(line.start, line.end, line.thickness, line.color);
+		lines.clear();
+		return;
+	}
+
+	// Draw what raylib has batched so far first, so the lines go on top of it like DrawLineEx would
+	rlDrawRenderBatchActive();
+
+	int count = (int)lines.size();
+	rlEnableVertexArray(vertexArray);
+	if (count > instanceCapacity)
+	{
+		int capacity = instanceCapacity;
+		while (capacity < count) capacity *= 2;
+		loadInstanceBuffer(capacity);
+	}
+	rlUpdateVertexBuffer(instanceBuffer, lines.data(), count * sizeof(LineInstance), 0);
+
+	Matrix mvp = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+	rlEnableShader(shader.id);
+	rlSetUniformMatrix(mvpLocation, mvp);
+	rlDrawVertexArrayInstanced(0, 6, count);
+	rlDisableShader();
+	rlDisableVertexArray();
+
+	lines.clear();
+}
@@ -8,297 +8,117 @@ See documentation here: https://www.raylib.com/, and examples here: https://www.
 #define RAYGUI_IMPLEMENTATION
 #include "raygui.h"
 #include "game.h"
+#include "fizziks.h" // All the physics lives here now, this file only draws it and handles input
+#include "fizziks_compute.h"
+#include "line_renderer.h"
 #include <string>
 #include <vector>
 
 const unsigned int TARGET_FPS = 50; //frames/second
 float dt = 1.0f / TARGET_FPS; //seconds/frame
-float time = 0;
-float coefficientOfFriction = 0.5f;
+float simulationTime = 0; // seconds. Not called "time" because that clashes with time() from <ctime>
 
-/// 
-/// FrizziksObjekts Declarions
-/// 
+float speed = 0;
+float angle = 0;
+bool showFrameStats = false; // F3 shows raylib's frame time breakdown, F4 saves it to framestats.csv
 
-enum FizziksShape
-{
-	CIRCLE,
-	HALF_SPACE
-};
+FizziksWorld world;
+FizziksHalfspace halfspace;
+FizziksHalfspace halfspace2;
+LineRenderer debugLineRenderer; // Velocity and force lines, all drawn with one draw call at the end of draw()
 
-class FizziksObjekt
-{
-public:
-	bool isStatic = false; // if this is set to true, don't move object according to velocity or gravity
-	Vector2 position = { 0,0 }; // In px
-	Vector2 velocity = { 0,0 }; // in px/s
-	float mass = 1; // in kg
-	Vector2 netForce = { 0,0 }; // in N
-	float grippiness = 0.1f;
-
-	std::string name = "objekt";		
-	Color color = RED;
-
-	virtual void draw() // virtual keyword is required to allow this function to be overriden
-	{
-		DrawCircle(position.x, position.y, 2, color);
-		//DrawText(name.c_str(), position.x, position.y, 12, LIGHTGRAY);
-	}
+FizziksComputeSolver gpuPhysics; // Circle physics in compute shaders, C toggles it
+bool useGpuPhysics = false;
+bool circlesOnGpu = false; // The GPU did this frame's step, so draw() draws the circles straight from its buffer
 
-	virtual FizziksShape Shape() = 0; // This is a pure virtual, or "abstract" function. 
-	//It is a declaration that has no definition itself, but must be defined in child classes.
-};
 
-class FizziksCircle : public FizziksObjekt
-{
-public:
-	float radius; // circle radius in pixels
+/// 
+/// Drawing
+/// 
+/// The physics library never draws, so the game does it here by asking each objekt what it is.
+///
 
-	void draw() override // if we want to override a parent class function, 
-		// the signature (name, return type, parameter list) must match exactly
-		// the override keyword makes sure you are actually overriding something. 
-		// If you are not (i.e. you did it wrong) it will tell you by making a compile-time error
+void DrawFizziksObjekt(FizziksObjekt* objekt)
+{
+	switch (objekt->Shape())
 	{
-		DrawCircle(position.x, position.y, radius, color);
-
-		DrawText(name.c_str(), position.x, position.y, radius * 2, LIGHTGRAY);
-
-		//Draw velocity (for fun)
-		DrawLineEx(position, position + velocity, 1, color);
-	}
-
-	FizziksShape Shape() override
+	case CIRCLE:
 	{
-		return CIRCLE;
-	}
-};
+		FizziksCircle* circle = (FizziksCircle*)objekt;
+		if (!circlesOnGpu) DrawCircle(circle->position.x, circle->position.y, circle->radius, circle->color); // Otherwise gpuPhysics.drawCircles() did it
 
-class FizziksHalfspace : public FizziksObjekt
-{
-private:
-	//FizziksObjekt::position in this context represents an arbitrary point that lies on the line.
-	float rotation = 0;
-	Vector2 normal = {0, -1}; // normal vector represents the direction perpendicular to the surface, pointing away from it.
-	//We always keep normal vectors at a magnitude of 1, so they denote orrientation, but no magnitude
-
-public:
-	void setRotationDegrees(float rotationInDegrees)
-	{
-		rotation = rotationInDegrees;
-		normal = Vector2Rotate({ 0, -1 }, rotation * DEG2RAD);
-	}
+		if (circle->isFluid) return; // Thousands of labels would just be noise
 
-	float getRotation()
-	{
-		return rotation;
-	}
+		//Labels go on layer 1 so they stay on top of every circle (see BeginSortedMode in draw()). The velocity and debug lines
+		//are drawn after EndSortedMode, so they end up on top of the labels
+		SetDrawLayer(1);
+		DrawText(circle->name.c_str(), circle->position.x, circle->position.y, circle->radius * 2, LIGHTGRAY);
+		SetDrawLayer(0);
 
-	Vector2 getNormal()
-	{
-		return normal;
+		//Draw velocity (for fun). Queued, debugLineRenderer.draw() draws them all at once
+		debugLineRenderer.add(circle->position, circle->position + circle->velocity, 1, circle->color);
+		break;
 	}
-
-	void draw() override
+	case HALF_SPACE:
 	{
+		FizziksHalfspace* halfspace = (FizziksHalfspace*)objekt;
+		Vector2 position = halfspace->position;
+		Vector2 normal = halfspace->getNormal();
+
 		//Draw arbitrary point on the line
-		DrawCircle(position.x, position.y, 8, color);
+		DrawCircle(position.x, position.y, 8, halfspace->color);
 
 		//Draw normal vector, perpendicular to the surface
-		DrawLineEx(position, position + normal * 30, 1, color);
+		DrawLineEx(position, position + normal * 30, 1, halfspace->color);
 
 		//Draw the line/surface
 		//Rotate function takes radians. 360 degrees = 2PI radians 
 		Vector2 parallelToSurface = Vector2Rotate(normal, PI * 0.5f);
-		DrawLineEx(position - parallelToSurface * 4000, position + parallelToSurface * 4000, 1, color);
+		DrawLineEx(position - parallelToSurface * 4000, position + parallelToSurface * 4000, 1, halfspace->color);
+		break;
 	}
-
-	FizziksShape Shape() override
-	{
-		return HALF_SPACE;
+	default:
+		DrawCircle(objekt->position.x, objekt->position.y, 2, objekt->color);
+		break;
 	}
-};
-
-/// 
-/// World
-/// 
-/// 
-
-
-bool CircleCircleCollisionResponse(FizziksCircle* circleA, FizziksCircle* circleB);
-bool CircleHalfspaceCollisionResponse(FizziksCircle* circle, FizziksHalfspace* halfspace); 
+}
 
-class FizziksWorld
+void DrawFizziksConstraint(FizziksConstraint* constraint)
 {
-private:
-	unsigned int objektCount = 0;
-public: 
-	std::vector<FizziksObjekt*> objekts; // All objects in physics simulation
-	
-	Vector2 accelerationGravity = {0, 10};
-
-	void add(FizziksObjekt* newObject) // Add to physics simulation
+	switch (constraint->Type())
 	{
-		newObject->name = std::to_string(objektCount);
-		objekts.push_back(newObject);
-		objektCount++;
-	}
-
-	void resetNetForces()
+	case DISTANCE_CONSTRAINT:
 	{
-		for (int i = 0; i < objekts.size(); i++)
-		{
-			objekts[i]->netForce = { 0,0 };
-		}
+		FizziksDistanceConstraint* distance = (FizziksDistanceConstraint*)constraint;
+		DrawLineEx(distance->a->position, distance->b->position, 2, distance->isRope ? BROWN : LIGHTGRAY);
+		break;
 	}
-
-	void addGravityForce()
+	case PIN_CONSTRAINT:
 	{
-		for (int i = 0; i < objekts.size(); i++)
-		{
-			FizziksObjekt* objekt = objekts[i];
-
-			// Avoid modifying position and applying gravity to objects we label "static"
-			if (objekt->isStatic) continue;
-
-			// F = ma therefore Fg = object mass * acceleration due to gravity
-			Vector2 FGravity = world.accelerationGravity * objekt->mass;
-			objekt->netForce += FGravity;
-			DrawLineEx(objekt->position, objekt->position - FGravity, 1, PURPLE);
-		}
-	}
-
-	void applyKinematics()
-	{
-		for (int i = 0; i < objekts.size(); i++)
-		{
-			FizziksObjekt* objekt = objekts[i];
-
-			// Avoid modifying position and applying gravity to objects we label "static"
-			if (objekt->isStatic) continue;
-
-			//vel = change in position / time, therefore     change in position = vel * time 
-			objekt->position = objekt->position + objekt->velocity * dt;
-
-			Vector2 acceleration = objekt->netForce/objekt->mass; // F = ma, so a = F/m where F is net force on an object
-
-			//accel = deltaV / time (change in velocity over time) therefore     deltaV = accel * time
-			objekt->velocity = objekt->velocity + acceleration * dt;
-
-			//DrawLineEx(objekt->position, objekt->position - objekt->netForce, 4, GRAY);
-		}
-	}
-
-	// Update state of all physics objects
-	void update()
-	{
-		resetNetForces(); // Set net forces variable to zero, Fizziksobjekt.netForce tracks all forces applying to it in one frame
-
-		addGravityForce(); // Add Gravity Force
-
-		checkCollisions(); // Apply collision Detection and Response, Add Normal Force if applicable
-
-		applyKinematics(); // Accelerate and Move objects according to a = F/m and kinematics equations
-	}
-
-	void checkCollisions()
-	{
-		//Start by painting everything green. When they touch they will be turned red and stay that way
-		for (int i = 0; i < objekts.size(); i++)
-		{
-			objekts[i]->color = GREEN;
-		}
-
-		//assuming all objects in objekts are circles...
-		//for each object...
-		for (int i = 0; i < objekts.size(); i++)
-		{
-			//check against another object...
-			for (int j = i + 1; j < objekts.size(); j++)
-			{
-				FizziksObjekt* objektPointerA = objekts[i];
-				FizziksObjekt* objektPointerB = objekts[j];
-				
-				//Ask objects what shape they are
-				FizziksShape shapeOfA = objektPointerA->Shape();
-				FizziksShape shapeOfB = objektPointerB->Shape();
-
-				bool didOverlap = false;
-
-				//
-				if (shapeOfA == CIRCLE && shapeOfB == CIRCLE)
-				{
-					didOverlap = CircleCircleCollisionResponse((FizziksCircle*)objektPointerA, (FizziksCircle*)objektPointerB);
-				}
-					//If one is a circle and one is a halfspace
-				else if (shapeOfA == CIRCLE && shapeOfB == HALF_SPACE)
-				{
-					didOverlap = CircleHalfspaceCollisionResponse((FizziksCircle*)objektPointerA, (FizziksHalfspace*)objektPointerB);
-				}
-				else if (shapeOfA == HALF_SPACE && shapeOfB == CIRCLE)
-				{
-					didOverlap = CircleHalfspaceCollisionResponse((FizziksCircle*)objektPointerB, (FizziksHalfspace*)objektPointerA);
-				}
-			
-				if(didOverlap)
-				{
-					objektPointerA->color = RED;
-					objektPointerB->color = RED;
-				}
-			}
-		}
+		FizziksPinConstraint* pin = (FizziksPinConstraint*)constraint;
+		DrawCircleV(pin->anchor, 4, WHITE);
+		DrawLineEx(pin->anchor, pin->objekt->position, 1, WHITE);
+		break;
 	}
-};
-
-float speed = 0;
-float angle = 0;
-
-FizziksWorld world;
-FizziksHalfspace halfspace;
-FizziksHalfspace halfspace2;
-
-/// 
-/// Collision Response Functions
-/// 
-
-bool CircleCircleOverlap(FizziksCircle* circleA, FizziksCircle* circleB) // returns true if circles are overlapping
-{
-	Vector2 displacementFromAToB = circleB->position - circleA->position;
-	float distance = Vector2Length(displacementFromAToB); //Use pythagorean theorem to get magnitude of displacement vector between circles to get a distance
-	float sumOfRadii = circleA->radius + circleB->radius;
-
-	if (sumOfRadii > distance)
-	{
-		return true; //overlapping
+	case HINGE_CONSTRAINT:
+		DrawCircleLinesV(((FizziksHingeConstraint*)constraint)->b->position, 6, YELLOW);
+		break;
 	}
-	else
-		return false; // not overlapping
 }
 
-bool CircleCircleCollisionResponse(FizziksCircle* circleA, FizziksCircle* circleB) // returns true if circles are overlapping
+void DrawFizziksForceField(const FizziksForceField& field)
 {
-	Vector2 displacementFromAToB = circleB->position - circleA->position;
-	float distance = Vector2Length(displacementFromAToB); //Use pythagorean theorem to get magnitude of displacement vector between circles to get a distance
-	float sumOfRadii = circleA->radius + circleB->radius;
-	float overlab = sumOfRadii - distance;
-	if (overlab > 0)
-	{
-		Vector2 normalAtoB;
-		if (abs(distance) < 0.0001f)
-			normalAtoB = { 0, 1 };
-		else
-			normalAtoB = (displacementFromAToB / distance);
-
-		Vector2 mtv = normalAtoB * overlab; // miniumum translation vector. Shortest distance
-
-		circleA->position -= mtv * 0.5f;
-		circleB->position += mtv * 0.5f;
-		return true; //overlapping
-	}
-	else
-		return false; // not overlapping
+	Color fieldColor = field.type == RADIAL_FIELD ? (field.strength >= 0 ? VIOLET : PINK) : (field.type == VORTEX_FIELD ? GOLD : SKYBLUE);
+	if (field.radius > 0) DrawCircleLinesV(field.position, field.radius, Fade(fieldColor, 0.5f));
+	DrawCircleV(field.position, 4, fieldColor);
+	if (field.type == WIND_FIELD) DrawLineEx(field.position, field.position + field.windVelocity, 2, fieldColor);
 }
 
-// Returns true if the circle overlaps the halfspace, false otherwise
+/// 
+/// Collision Debugging
+/// 
+
+// Returns true if the circle overlaps the halfspace, false otherwise. Draws the distance for debugging
 bool CircleHalfspaceOverlap(FizziksCircle* circle, FizziksHalfspace* halfspace) // returns true if circles are overlapping
 {
 	//Get a displacement vector FROM the arbitrary point on the halfspace TO the circle
@@ -323,59 +143,6 @@ bool CircleHalfspaceOverlap(FizziksCircle* circle, FizziksHalfspace* halfspace)
 	return dot < circle->radius;
 }
 
-// Returns true if the circle overlaps the halfspace, false otherwise
-bool CircleHalfspaceCollisionResponse(FizziksCircle* circle, FizziksHalfspace* halfspace) // returns true if circles are overlapping
-{
-	Vector2 displacementToCircle = circle->position - halfspace->position;
-	float dot = Vector2DotProduct(displacementToCircle, halfspace->getNormal());
-	Vector2 projectionDisplacementOntoNormal = halfspace->getNormal() * dot;
-
-	//DrawLineEx(circle->position, circle->position - projectionDisplacementOntoNormal, 1, GRAY);
-	//Vector2 midpoint = circle->position - projectionDisplacementOntoNormal * 0.5f;
-	//DrawText(TextFormat("D: %6.0f", dot), midpoint.x, midpoint.y, 30, GRAY);
-
-	float overlap = circle->radius - dot;
-
-	if (overlap > 0)
-	{
-		// Move!
-		Vector2 mtv = halfspace->getNormal() * overlap;
-		circle->position += mtv;
-
-		// Get Gravity Force
-		Vector2 Fgravity = world.accelerationGravity * circle->mass;
-
-		// Apply normal force
-		Vector2 FgPerp = halfspace->getNormal() * Vector2DotProduct(Fgravity, halfspace->getNormal());
-		Vector2 Fnormal = FgPerp * -1;
-		circle->netForce += Fnormal;
-		DrawLineEx(circle->position, circle->position + Fnormal, 1, GREEN);
-
-		// Friction 
-		// F = uN where u is coefficient of friction between 2 surfaces
-		// F is the max Magnitube of force of friction
-		// N is the magnitude of the normal force
-		float u = circle->grippiness * halfspace->grippiness;
-		float frictionMagnitude = u * Vector2Length(Fnormal);
-
-		// The Direction of friction = opposite other applied forces in the surface plane
-		Vector2 FgPara = Fgravity - FgPerp;
-		Vector2 frictionDirection = Vector2Normalize(FgPara) * -1;
-
-		Vector2 Ffriction = frictionDirection * frictionMagnitude;
-
-		float frictionForceLength = Vector2Length(Ffriction);
-
-		circle->netForce += Ffriction;
-		DrawLineEx(circle->position, circle->position + Fnormal, 2, ORANGE);
-
-		return true;
-	}
-	else
-	{
-		return false;
-	}
-}
 
 /// 
 /// Game Loop Functions
@@ -398,6 +165,7 @@ void cleanup()
 			//Destroy!
 			std::vector<FizziksObjekt*>::iterator iterator = (world.objekts.begin() + i);
 			FizziksObjekt* pointerToFizziksObjekt = *iterator;
+			world.removeConstraintsOf(pointerToFizziksObjekt);
 			delete pointerToFizziksObjekt;
 
 			world.objekts.erase(iterator);
@@ -411,10 +179,131 @@ void cleanup()
 void update()
 {
 	dt = 1.0f / TARGET_FPS;
-	time += dt;
+	simulationTime += dt;
 
 	cleanup();
-	world.update();
+	world.dt = dt;
+
+	//The GPU can only do plain circles and halfspaces. Anything fancier (fluid, ropes, fields) falls back to the CPU
+	circlesOnGpu = useGpuPhysics && gpuPhysics.canSimulate(world);
+	if (circlesOnGpu)
+	{
+		gpuPhysics.upload(world);
+		gpuPhysics.step(dt);
+		gpuPhysics.download(world); // cleanup(), labels and velocity lines still need the positions on the CPU
+	}
+	else
+	{
+		world.update();
+	}
+
+	// Run the circle physics in compute shaders (needs OpenGL 4.3)
+	if (IsKeyPressed(KEY_C)) useGpuPhysics = !useGpuPhysics;
+
+	// Cycle through the integrators to compare them
+	if (IsKeyPressed(KEY_I))
+	{
+		world.integrator = (FizziksIntegrator)((world.integrator + 1) % (POSITION_VERLET + 1));
+	}
+
+	// Build a rope bridge: a chain of small circles hanging between two pins
+	if (IsKeyPressed(KEY_R))
+	{
+		const int linkCount = 40;
+		Vector2 leftPin = { 400, 300 };
+		Vector2 rightPin = { 1200, 300 };
+		float linkLength = Vector2Distance(leftPin, rightPin) / (linkCount - 1) * 1.1f; // A bit of sag
+
+		FizziksCircle* previousLink = nullptr;
+		for (int i = 0; i < linkCount; i++)
+		{
+			FizziksCircle* link = new FizziksCircle();
+			link->position = Vector2Lerp(leftPin, rightPin, i / (float)(linkCount - 1));
+			link->radius = 6;
+			link->color = BROWN;
+			world.add(link);
+
+			if (previousLink != nullptr)
+			{
+				FizziksDistanceConstraint* rope = new FizziksDistanceConstraint();
+				rope->a = previousLink;
+				rope->b = link;
+				rope->restLength = linkLength;
+				rope->isRope = true;
+				world.addConstraint(rope);
+			}
+			previousLink = link;
+
+			if (i == 0 || i == linkCount - 1)
+			{
+				FizziksPinConstraint* pin = new FizziksPinConstraint();
+				pin->objekt = link;
+				pin->anchor = link->position;
+				world.addConstraint(pin);
+			}
+		}
+	}
+
+	// Pour a block of water
+	if (IsKeyPressed(KEY_F))
+	{
+		const float spacing = sqrtf(1.0f / world.fluid.restDensity); // 1kg particles at rest density
+		for (int row = 0; row < 25; row++)
+		{
+			for (int column = 0; column < 40; column++)
+			{
+				FizziksCircle* drop = new FizziksCircle();
+				drop->position = { 600 + column * spacing, 300 + row * spacing };
+				drop->radius = spacing * 0.5f;
+				drop->isFluid = true;
+				drop->color = SKYBLUE;
+				world.add(drop);
+			}
+		}
+	}
+
+	// Force fields at the mouse: G = gravity well, H = repulsor, V = vortex
+	if (IsKeyPressed(KEY_G) || IsKeyPressed(KEY_H) || IsKeyPressed(KEY_V))
+	{
+		FizziksForceField field;
+		field.type = IsKeyPressed(KEY_V) ? VORTEX_FIELD : RADIAL_FIELD;
+		field.position = GetMousePosition();
+		field.radius = 200;
+		field.strength = IsKeyPressed(KEY_H) ? -300.0f : 300.0f;
+		world.forceFields.push_back(field);
+	}
+
+	// Orbit demo: a heavy sun with a disc of small circles on circular orbits, held together by mutual gravity
+	if (IsKeyPressed(KEY_O))
+	{
+		world.mutualGravity.enabled = true;
+		world.accelerationGravity = { 0,0 };
+
+		Vector2 centre = { GetScreenWidth() * 0.5f, GetScreenHeight() * 0.5f };
+		FizziksCircle* sun = new FizziksCircle();
+		sun->position = centre;
+		sun->radius = 20;
+		sun->mass = 2000;
+		sun->color = YELLOW;
+		world.add(sun);
+
+		for (int i = 0; i < 2000; i++)
+		{
+			float distance = 80 + (rand() % 300);
+			float orbitAngle = (rand() % 3600) * 0.1f * DEG2RAD;
+			float orbitSpeed = sqrtf(world.mutualGravity.G * sun->mass / distance); // Circular orbit: v^2/r = GM/r^2
+
+			FizziksCircle* planet = new FizziksCircle();
+			planet->position = centre + Vector2{ cosf(orbitAngle), sinf(orbitAngle) } * distance;
+			planet->velocity = Vector2{ -sinf(orbitAngle), cosf(orbitAngle) } * orbitSpeed;
+			planet->radius = 2;
+			planet->mass = 0.1f;
+			world.add(planet);
+		}
+	}
+
+	if (IsKeyPressed(KEY_F3)) showFrameStats = !showFrameStats;
+	if (IsKeyPressed(KEY_F4)) ExportFrameStats("framestats.csv");
 
 	if (IsKeyPressed(KEY_SPACE))
 	{
@@ -441,7 +330,7 @@ void draw()
 	DrawText("Alejandro-Revollo 101552111", 10, float(GetScreenHeight() - 30), 20, LIGHTGRAY);
 
 
-	GuiSliderBar(Rectangle{ 10, 15, 1000, 20 }, "", TextFormat("%.2f", time), &time, 0, 240);
+	GuiSliderBar(Rectangle{ 10, 15, 1000, 20 }, "", TextFormat("%.2f", simulationTime), &simulationTime, 0, 240);
 
 	GuiSliderBar(Rectangle{ 10, 40, 500, 30 }, "Speed", TextFormat("Speed: %.0f", speed), &speed, -1000, 1000);
 
@@ -451,7 +340,14 @@ void draw()
 
 	DrawText(TextFormat("Obects: %i", world.objekts.size()), 10, 160, 30, LIGHTGRAY);
 
-	DrawText(TextFormat("T: %6.2f", time), GetScreenWidth() - 140, 10, 30, LIGHTGRAY);
+	DrawText(TextFormat("Integrator (I): %s", FizziksIntegratorName(world.integrator)), 300, 160, 30, LIGHTGRAY);
+
+	const char* physicsDevice = !useGpuPhysics ? "CPU" : (!gpuPhysics.isLoaded() ? "CPU (no compute shaders)" : (circlesOnGpu ? "GPU" : "CPU (scene not supported)"));
+	DrawText(TextFormat("Physics (C): %s", physicsDevice), 900, 160, 30, LIGHTGRAY);
+
+	DrawText(TextFormat("T: %6.2f", simulationTime), GetScreenWidth() - 140, 10, 30, LIGHTGRAY);
+
+	if (showFrameStats) DrawFrameStats(GetScreenWidth() - 260, 50);
 
 	Vector2 startPos = { 100, GetScreenHeight() - 100 };
 	Vector2 velocity = {speed * cos(angle * DEG2RAD), -speed * sin(angle * DEG2RAD)};
@@ -469,17 +365,44 @@ void draw()
 	// Control for Friction
 	GuiSliderBar(Rectangle{ 80, 20, 300, 30 }, "u", TextFormat("%.2f", halfspace.grippiness), &halfspace.grippiness, 0, 1);
 
+	//Sorted mode: raylib groups the world's draws by texture and shape type instead of drawing them in call order.
+	//Circles, lines and text labels use different textures/primitives, so in call order every objekt costs
+	//several draw calls. Sorted, it's a handful per frame. Circles still draw in the same order among themselves
+	BeginSortedMode();
+
+	for (int i = 0; i < world.forceFields.size(); i++)
+	{
+		DrawFizziksForceField(world.forceFields[i]);
+	}
+
+	for (int i = 0; i < world.constraints.size(); i++)
+	{
+		DrawFizziksConstraint(world.constraints[i]);
+	}
+
+	//Circles the GPU simulated are drawn from its buffer, all in one go. DrawFizziksObjekt still adds their labels and lines
+	if (circlesOnGpu) gpuPhysics.drawCircles();
+
 	//Draw all physics objects!
 	for (int i = 0; i < world.objekts.size(); i++)
 	{
-		world.objekts[i]->draw();
-		//Through the magic of polymorphism, we can place multiple 
-		// types of objects in world.objekts. Circle, Box, Halfspace etc.
-		// Then, when we call the parent function draw(), we should get the 
-		// derived class behaviour specific to what that object actually is e.g.
-		// Circle.draw() on a Circle, Box.draw() on a Box
+		DrawFizziksObjekt(world.objekts[i]);
+		//We can place multiple types of objects in world.objekts. Circle, Box, Halfspace etc.
+		// DrawFizziksObjekt asks each one for its Shape() to know how to draw it
 	}
 
+	//Debug lines the physics recorded during update (gravity, normal forces, friction)
+	for (int i = 0; i < world.debugLines.size(); i++)
+	{
+		const FizziksDebugLine& line = world.debugLines[i];
+		debugLineRenderer.add(line.start, line.end, line.thickness, line.color);
+	}
+
+	EndSortedMode();
+
+	//Every velocity and debug line queued above, in one instanced draw call on top of the world
+	debugLineRenderer.draw();
+
 	/*
 	// Draw FBD 
 	Vector2 location = { 300,800 };
@@ -504,6 +427,8 @@ int main()
 {
 	InitWindow(InitialWidth, InitialHeight, "GAME2005 Alejandro-Revollo 101552111");
 	SetTargetFPS(TARGET_FPS);
+	debugLineRenderer.load();
+	gpuPhysics.load();
 	halfspace.isStatic = true;
 	halfspace.position = { 200, 800 };
 	halfspace.setRotationDegrees(0);
@@ -520,6 +445,8 @@ int main()
 		draw();
 	}
 
+	gpuPhysics.unload();
+	debugLineRenderer.unload();
 	CloseWindow();
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,3 @@
+# Platform and graphics API defines. Feature switches come from src/config.h
+target_compile_definitions(raylib PUBLIC "${PLATFORM_CPP}")
+target_compile_definitions(raylib PUBLIC "${GRAPHICS}")
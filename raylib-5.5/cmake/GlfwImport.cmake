@@ -0,0 +1,5 @@
+# Builds the bundled GLFW the same way src/Makefile and raylib.vcxproj do: as one translation unit, rglfw.c
+if(${PLATFORM} MATCHES "Desktop")
+    list(APPEND raylib_sources rglfw.c)
+    include_directories(BEFORE SYSTEM ${CMAKE_CURRENT_SOURCE_DIR}/external/glfw/include)
+endif()
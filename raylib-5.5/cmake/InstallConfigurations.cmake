@@ -0,0 +1 @@
+# raylib is only built as part of physics-1 here, nothing is installed
@@ -0,0 +1,41 @@
+# Selects PLATFORM_CPP, the GRAPHICS API and the private link libraries (LIBS_PRIVATE) for each platform.
+# Only the desktop platforms are filled in, they are the only ones this project builds.
+if(${PLATFORM} MATCHES "Desktop")
+    set(PLATFORM_CPP "PLATFORM_DESKTOP")
+
+    if(APPLE)
+        find_library(OPENGL_LIBRARY OpenGL)
+        find_library(COCOA_LIBRARY Cocoa)
+        find_library(IOKIT_LIBRARY IOKit)
+        find_library(COREVIDEO_LIBRARY CoreVideo)
+        set(LIBS_PRIVATE ${OPENGL_LIBRARY} ${COCOA_LIBRARY} ${IOKIT_LIBRARY} ${COREVIDEO_LIBRARY})
+    elseif(WIN32)
+        add_definitions(-D_CRT_SECURE_NO_WARNINGS)
+        find_package(OpenGL QUIET)
+        set(LIBS_PRIVATE ${OPENGL_LIBRARIES} winmm)
+    elseif(UNIX)
+        find_package(Threads REQUIRED)
+        find_package(OpenGL QUIET)
+        if("${OPENGL_LIBRARIES}" STREQUAL "")
+            set(OPENGL_LIBRARIES "GL")
+        endif()
+        set(LIBS_PRIVATE m Threads::Threads ${OPENGL_LIBRARIES} ${CMAKE_DL_LIBS})
+        if(NOT ${CMAKE_SYSTEM_NAME} MATCHES "Linux")
+            find_library(OSS_LIBRARY ossaudio)
+            if(OSS_LIBRARY)
+                list(APPEND LIBS_PRIVATE ${OSS_LIBRARY})
+            endif()
+        endif()
+        find_package(X11 REQUIRED)
+        include_directories(${X11_INCLUDE_DIR})
+        list(APPEND LIBS_PRIVATE ${X11_LIBRARIES})
+    endif()
+endif()
+
+if(NOT GRAPHICS)
+    set(GRAPHICS "GRAPHICS_API_OPENGL_33")
+endif()
+
+if(NOT DEFINED SUPPORT_MODULE_RAUDIO)
+    set(SUPPORT_MODULE_RAUDIO ON) # config.h enables it by default
+endif()
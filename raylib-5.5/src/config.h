@@ -66,6 +66,9 @@
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Support per-frame stats history: update/draw/swap/wait/poll times, rlgl draw calls, vertex and flushes
+// NOTE: It only adds a few timer reads per frame, see GetFrameStats()
+#define SUPPORT_FRAME_STATS             1
 // Support custom frame control, only for advanced users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -91,6 +94,8 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define MAX_FRAME_STATS               240       // Maximum number of frames stats kept (ring buffer)
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -104,9 +109,11 @@
 #define RL_SUPPORT_MESH_GPU_SKINNING           1      // GPU skinning, comment if your GPU does not support more than 8 VBOs
 
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
-#define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
+#define RL_DEFAULT_BATCH_BUFFERS               3      // Default number of batch buffers (multi-buffering, streamed through persistent mapped buffers on GL 4.4)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+//#define RL_MAX_BATCH_BUFFER_ELEMENTS     65536      // Maximum elements the default batch grows to when frames need more (16384 on ES2, set to default size to disable growth)
+#define RL_MAX_BATCH_DRAWCALLS             16384      // Maximum draw calls the default batch grows to when frames need more
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal Matrix stack
 
@@ -186,6 +193,9 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Split heavy image processing (blur, convolution...) across CPU threads
+// NOTE: Requires pthreads or Win32 threads, on web only used when built with pthreads support
+#define SUPPORT_IMAGE_THREADS           1
 
 
 //------------------------------------------------------------------------------------
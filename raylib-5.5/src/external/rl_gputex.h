@@ -98,6 +98,10 @@ RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int
 // Get pixel data size in bytes for certain pixel format
 static int get_pixel_data_size(int width, int height, int format);
 
+// Copy image data from file data, without reading past its end
+// NOTE: File data can be a memory mapped file, reading past its end would crash
+static void *copy_image_data(const unsigned char *file_data, unsigned int file_size, const unsigned char *data_ptr, int data_size);
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -186,9 +190,7 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                 {
                     int data_size = image_pixel_size*sizeof(unsigned short);
                     if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
-                    image_data = RL_MALLOC(data_size);
-
-                    memcpy(image_data, file_data_ptr, data_size);
+                    image_data = copy_image_data(file_data, file_size, file_data_ptr, data_size);
 
                     *format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
                 }
@@ -198,14 +200,12 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                     {
                         int data_size = image_pixel_size*sizeof(unsigned short);
                         if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
-                        image_data = RL_MALLOC(data_size);
-
-                        memcpy(image_data, file_data_ptr, data_size);
+                        image_data = copy_image_data(file_data, file_size, file_data_ptr, data_size);
 
                         unsigned char alpha = 0;
 
                         // NOTE: Data comes as A1R5G5B5, it must be reordered to R5G5B5A1
-                        for (int i = 0; i < image_pixel_size; i++)
+                        for (int i = 0; (image_data != NULL) && (i < image_pixel_size); i++)
                         {
                             alpha = ((unsigned short *)image_data)[i] >> 15;
                             ((unsigned short *)image_data)[i] = ((unsigned short *)image_data)[i] << 1;
@@ -218,14 +218,12 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                     {
                         int data_size = image_pixel_size*sizeof(unsigned short);
                         if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
-                        image_data = RL_MALLOC(data_size);
-
-                        memcpy(image_data, file_data_ptr, data_size);
+                        image_data = copy_image_data(file_data, file_size, file_data_ptr, data_size);
 
                         unsigned char alpha = 0;
 
                         // NOTE: Data comes as A4R4G4B4, it must be reordered R4G4B4A4
-                        for (int i = 0; i < image_pixel_size; i++)
+                        for (int i = 0; (image_data != NULL) && (i < image_pixel_size); i++)
                         {
                             alpha = ((unsigned short *)image_data)[i] >> 12;
                             ((unsigned short *)image_data)[i] = ((unsigned short *)image_data)[i] << 4;
@@ -240,9 +238,7 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
             {
                 int data_size = image_pixel_size*3*sizeof(unsigned char);
                 if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
-                image_data = RL_MALLOC(data_size);
-
-                memcpy(image_data, file_data_ptr, data_size);
+                image_data = copy_image_data(file_data, file_size, file_data_ptr, data_size);
 
                 *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
             }
@@ -250,16 +246,14 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
             {
                 int data_size = image_pixel_size*4*sizeof(unsigned char);
                 if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
-                image_data = RL_MALLOC(data_size);
-
-                memcpy(image_data, file_data_ptr, data_size);
+                image_data = copy_image_data(file_data, file_size, file_data_ptr, data_size);
 
                 unsigned char blue = 0;
 
                 // NOTE: Data comes as A8R8G8B8, it must be reordered R8G8B8A8 (view next comment)
                 // DirecX understand ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA
                 // So, we must realign B8G8R8A8 to R8G8B8A8
-                for (int i = 0; i < image_pixel_size*4; i += 4)
+                for (int i = 0; (image_data != NULL) && (i < image_pixel_size*4); i += 4)
                 {
                     blue = ((unsigned char *)image_data)[i];
                     ((unsigned char *)image_data)[i] = ((unsigned char *)image_data)[i + 2];
@@ -276,9 +270,7 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                 if (header->mipmap_count > 1) data_size = header->pitch_or_linear_size + header->pitch_or_linear_size / 3;
                 else data_size = header->pitch_or_linear_size;
 
-                image_data = RL_MALLOC(data_size*sizeof(unsigned char));
-
-                memcpy(image_data, file_data_ptr, data_size);
+                image_data = copy_image_data(file_data, file_size, file_data_ptr, data_size);
 
                 switch (header->ddspf.fourcc)
                 {
@@ -338,7 +330,7 @@ void *rl_load_pkm_from_memory(const unsigned char *file_data, unsigned int file_
 
     if (file_data_ptr != NULL)
     {
-        pkm_header *header = (pkm_header *)file_data_ptr;
+        const pkm_header *header = (const pkm_header *)file_data_ptr;
 
         if ((header->id[0] != 'P') || (header->id[1] != 'K') || (header->id[2] != 'M') || (header->id[3] != ' '))
         {
@@ -349,26 +341,22 @@ void *rl_load_pkm_from_memory(const unsigned char *file_data, unsigned int file_
             file_data_ptr += sizeof(pkm_header);   // Skip header
 
             // NOTE: format, width and height come as big-endian, data must be swapped to little-endian
-            header->format = ((header->format & 0x00FF) << 8) | ((header->format & 0xFF00) >> 8);
-            header->width = ((header->width & 0x00FF) << 8) | ((header->width & 0xFF00) >> 8);
-            header->height = ((header->height & 0x00FF) << 8) | ((header->height & 0xFF00) >> 8);
-
-            *width = header->width;
-            *height = header->height;
+            // File data is not modified, it could be read-only (memory mapped file)
+            int pkm_format = ((header->format & 0x00FF) << 8) | ((header->format & 0xFF00) >> 8);
+            *width = ((header->width & 0x00FF) << 8) | ((header->width & 0xFF00) >> 8);
+            *height = ((header->height & 0x00FF) << 8) | ((header->height & 0xFF00) >> 8);
             *mips = 1;
 
             int bpp = 4;
-            if (header->format == 3) bpp = 8;
+            if (pkm_format == 3) bpp = 8;
 
             int data_size = (*width)*(*height)*bpp/8;  // Total data size in bytes
 
-            image_data = RL_MALLOC(data_size*sizeof(unsigned char));
-
-            memcpy(image_data, file_data_ptr, data_size);
+            image_data = copy_image_data(file_data, file_size, file_data_ptr, data_size);
 
-            if (header->format == 0) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
-            else if (header->format == 1) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
-            else if (header->format == 3) *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+            if (pkm_format == 0) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
+            else if (pkm_format == 1) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
+            else if (pkm_format == 3) *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
         }
     }
 
@@ -441,9 +429,7 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
             int data_size = ((int *)file_data_ptr)[0];
             file_data_ptr += sizeof(int);
 
-            image_data = RL_MALLOC(data_size*sizeof(unsigned char));
-
-            memcpy(image_data, file_data_ptr, data_size);
+            image_data = copy_image_data(file_data, file_size, file_data_ptr, data_size);
 
             if (header->gl_internal_format == 0x8D64) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
             else if (header->gl_internal_format == 0x9274) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
@@ -697,9 +683,7 @@ void *rl_load_pvr_from_memory(const unsigned char *file_data, unsigned int file_
                 }
 
                 int data_size = (*width)*(*height)*bpp/8;  // Total data size in bytes
-                image_data = RL_MALLOC(data_size*sizeof(unsigned char));
-
-                memcpy(image_data, file_data_ptr, data_size);
+                image_data = copy_image_data(file_data, file_size, file_data_ptr, data_size);
             }
         }
         else if (pvr_version == 52) LOG("INFO: IMAGE: PVRv2 format not supported, update your files to PVRv3");
@@ -761,9 +745,7 @@ void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file
             {
                 int data_size = (*width)*(*height)*bpp/8;  // Data size in bytes
 
-                image_data = RL_MALLOC(data_size*sizeof(unsigned char));
-
-                memcpy(image_data, file_data_ptr, data_size);
+                image_data = copy_image_data(file_data, file_size, file_data_ptr, data_size);
 
                 if (bpp == 8) *format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA;
                 else if (bpp == 2) *format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA;
@@ -779,6 +761,28 @@ void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
+// Copy image data from file data, without reading past its end
+// NOTE: Image data missing from the file is set to zero, mipmaps data sizes
+// are estimated (data_size + data_size/3) and can go a few bytes over
+static void *copy_image_data(const unsigned char *file_data, unsigned int file_size, const unsigned char *data_ptr, int data_size)
+{
+    void *image_data = NULL;
+    unsigned int data_offset = (unsigned int)(data_ptr - file_data);
+
+    if ((data_size > 0) && (data_offset < file_size))
+    {
+        unsigned int copy_size = file_size - data_offset;
+        if (copy_size > (unsigned int)data_size) copy_size = (unsigned int)data_size;
+
+        image_data = RL_MALLOC(data_size*sizeof(unsigned char));
+        memcpy(image_data, data_ptr, copy_size);
+        if (copy_size < (unsigned int)data_size) memset((unsigned char *)image_data + copy_size, 0, data_size - copy_size);
+    }
+    else LOG("WARNING: IMAGE: File data does not contain image data");
+
+    return image_data;
+}
+
 // Get pixel data size in bytes for certain pixel format
 static int get_pixel_data_size(int width, int height, int format)
 {
@@ -268,6 +268,22 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// ImageOperation, one operation recorded in an image pipeline
+typedef struct ImageOperation {
+    int type;               // Operation type (ImageOperationType)
+    int width;              // Resize: new width
+    int height;             // Resize: new height
+    float value;            // Contrast or brightness value
+    Color color;            // Tint color or color to replace
+    Color replace;          // Replace: new color
+} ImageOperation;
+
+// ImagePipeline, image operations recorded to be applied together in fused passes
+typedef struct ImagePipeline {
+    int operationCount;         // Number of recorded operations
+    ImageOperation *operations; // Recorded operations, applied in order
+} ImagePipeline;
+
 // Texture, tex data stored in GPU memory (VRAM)
 typedef struct Texture {
     unsigned int id;        // OpenGL texture id
@@ -293,6 +309,22 @@ typedef struct RenderTexture {
 // RenderTexture2D, same as RenderTexture
 typedef RenderTexture RenderTexture2D;
 
+// AtlasRegion, image packed in an atlas
+typedef struct AtlasRegion {
+    int page;               // Atlas page index (-1 if the image could not be packed)
+    Rectangle rec;          // Image rectangle in the atlas page (gutter not included)
+} AtlasRegion;
+
+// TextureAtlas, images packed at runtime into texture pages
+typedef struct TextureAtlas {
+    int width;              // Pages width
+    int height;             // Pages height
+    int padding;            // Gutter pixels around every image, repeating its edge pixels
+    int pageCount;          // Number of pages
+    Texture2D *pages;       // Pages textures (PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    void *packers;          // Pages packing state (internal)
+} TextureAtlas;
+
 // NPatchInfo, n-patch layout info
 typedef struct NPatchInfo {
     Rectangle source;       // Texture source rectangle
@@ -532,6 +564,21 @@ typedef struct AutomationEventList {
     AutomationEvent *events;        // Events entries
 } AutomationEventList;
 
+// Frame stats, per-frame time and rendering breakdown (SUPPORT_FRAME_STATS)
+// NOTE: Times are in seconds, updateTime excludes the input polling measured in pollTime
+typedef struct FrameStats {
+    unsigned int frame;             // Frame number
+    float updateTime;               // Time from previous frame end to BeginDrawing()
+    float drawTime;                 // Time from BeginDrawing() to buffers swap, including final batch submission
+    float swapTime;                 // Time spent on SwapScreenBuffer()
+    float waitTime;                 // Time spent waiting for target FPS
+    float pollTime;                 // Time spent on PollInputEvents()
+    float frameTime;                // Total frame time
+    unsigned int drawCalls;         // OpenGL draw calls issued by rlgl
+    unsigned int vertexCount;       // Vertex submitted through rlgl batches
+    unsigned int flushCount;        // rlgl render batch flushes
+} FrameStats;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -857,6 +904,20 @@ typedef enum {
     PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA    // 2 bpp
 } PixelFormat;
 
+// Image pipeline operation types
+typedef enum {
+    IMAGE_OPERATION_RESIZE = 0,             // Resize (Bicubic scaling algorithm)
+    IMAGE_OPERATION_RESIZE_NN,              // Resize (Nearest-Neighbor scaling algorithm)
+    IMAGE_OPERATION_COLOR_TINT,             // Color tint
+    IMAGE_OPERATION_COLOR_INVERT,           // Color invert
+    IMAGE_OPERATION_COLOR_GRAYSCALE,        // Color grayscale (alpha is kept)
+    IMAGE_OPERATION_COLOR_CONTRAST,         // Color contrast (-100 to 100)
+    IMAGE_OPERATION_COLOR_BRIGHTNESS,       // Color brightness (-255 to 255)
+    IMAGE_OPERATION_COLOR_REPLACE,          // Color replace
+    IMAGE_OPERATION_ALPHA_PREMULTIPLY,      // Premultiply alpha channel
+    IMAGE_OPERATION_MIPMAPS                 // Generate all mipmap levels (always done last)
+} ImageOperationType;
+
 // Texture parameters: filter mode
 // NOTE 1: Filtering considers mipmaps if available in the texture
 // NOTE 2: Filter is accordingly set for minification and magnification
@@ -1039,6 +1100,9 @@ RLAPI void BeginBlendMode(int mode);                              // Begin blend
 RLAPI void EndBlendMode(void);                                    // End blending mode (reset to default: alpha blending)
 RLAPI void BeginScissorMode(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing)
 RLAPI void EndScissorMode(void);                                  // End scissor mode
+RLAPI void BeginSortedMode(void);                                 // Begin sorted mode (draws grouped by layer, texture and shape type, fewer draw calls)
+RLAPI void EndSortedMode(void);                                   // End sorted mode
+RLAPI void SetDrawLayer(int layer);                               // Set layer for next draws in sorted mode, lower layers are drawn first
 RLAPI void BeginVrStereoMode(VrStereoConfig config);              // Begin stereo rendering (requires VR simulator)
 RLAPI void EndVrStereoMode(void);                                 // End stereo rendering (requires VR simulator)
 
@@ -1076,6 +1140,11 @@ RLAPI float GetFrameTime(void);                                   // Get time in
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
 RLAPI int GetFPS(void);                                           // Get current FPS
 
+// Frame stats functions (SUPPORT_FRAME_STATS), the last MAX_FRAME_STATS frames are kept
+RLAPI FrameStats GetFrameStats(int framesAgo);                    // Get stats for a recent frame (0 = last finished frame)
+RLAPI int GetFrameStatsCount(void);                               // Get number of frames stats available
+RLAPI bool ExportFrameStats(const char *fileName);                // Export frames stats as CSV, returns true on success
+
 // Custom frame control functions
 // NOTE: Those functions are intended for advanced users that want full control over the frame processing
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
@@ -1114,6 +1183,8 @@ RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI unsigned char *LoadFileMapped(const char *fileName, int *dataSize); // Load file data mapped in memory (read-only), NULL if it can not be mapped
+RLAPI void UnloadFileMapped(unsigned char *data, int dataSize);   // Unload file data mapped by LoadFileMapped()
 RLAPI bool SaveFileData(const char *fileName, void *data, int dataSize); // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
@@ -1332,6 +1403,8 @@ RLAPI void UnloadImage(Image image);
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
+RLAPI Image *LoadImageAtlas(const Image *images, int imageCount, int width, int height, int padding, AtlasRegion *regions, int *pageCount); // Load atlas pages packing images, regions of every image returned
+RLAPI void UnloadImageAtlas(Image *pages, int pageCount);                                                // Unload atlas pages loaded with LoadImageAtlas()
 
 // Image generation functions
 RLAPI Image GenImageColor(int width, int height, Color color);                                           // Generate image: plain color
@@ -1363,6 +1436,7 @@ RLAPI void ImageResize(Image *image, int newWidth, int newHeight);
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
+RLAPI void ImageMipmapsEx(Image *image, bool srgb);                                                      // Compute all mipmap levels for a provided image, averaging colors in linear light if srgb
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
@@ -1377,11 +1451,29 @@ RLAPI void ImageColorBrightness(Image *image, int brightness);
 RLAPI void ImageColorReplace(Image *image, Color color, Color replace);                                  // Modify image color: replace color
 RLAPI Color *LoadImageColors(Image image);                                                               // Load color data from image as a Color array (RGBA - 32bit)
 RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a Color array (RGBA - 32bit)
+RLAPI Color *LoadImagePaletteCounts(Image image, int maxPaletteSize, int *colorCount, int *counts);      // Load colors palette from image with pixels count of every color (counts: maxPaletteSize values or NULL)
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
-RLAPI void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette()
+RLAPI void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette() or LoadImagePaletteCounts()
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
 RLAPI Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
+// Image pipeline functions
+// NOTE: Operations are only recorded, ImageApplyPipeline() runs them all in fused passes with a single output allocation
+// (R8G8B8A8, R32G32B32 and R32G32B32A32 images, other formats run the Image*() functions one by one to give the same results)
+RLAPI ImagePipeline LoadImagePipeline(void);                                                             // Load an empty image pipeline
+RLAPI void UnloadImagePipeline(ImagePipeline pipeline);                                                  // Unload image pipeline recorded operations
+RLAPI void ImagePipelineResize(ImagePipeline *pipeline, int newWidth, int newHeight);                    // Record image operation: resize (Bicubic scaling algorithm)
+RLAPI void ImagePipelineResizeNN(ImagePipeline *pipeline, int newWidth, int newHeight);                  // Record image operation: resize (Nearest-Neighbor scaling algorithm)
+RLAPI void ImagePipelineColorTint(ImagePipeline *pipeline, Color color);                                 // Record image operation: color tint
+RLAPI void ImagePipelineColorInvert(ImagePipeline *pipeline);                                            // Record image operation: color invert
+RLAPI void ImagePipelineColorGrayscale(ImagePipeline *pipeline);                                         // Record image operation: color grayscale (alpha and image format are kept)
+RLAPI void ImagePipelineColorContrast(ImagePipeline *pipeline, float contrast);                          // Record image operation: color contrast (-100 to 100)
+RLAPI void ImagePipelineColorBrightness(ImagePipeline *pipeline, int brightness);                        // Record image operation: color brightness (-255 to 255)
+RLAPI void ImagePipelineColorReplace(ImagePipeline *pipeline, Color color, Color replace);               // Record image operation: replace color
+RLAPI void ImagePipelineAlphaPremultiply(ImagePipeline *pipeline);                                       // Record image operation: premultiply alpha channel
+RLAPI void ImagePipelineMipmaps(ImagePipeline *pipeline);                                                // Record image operation: generate all mipmap levels (always done last, 2x2 box filter)
+RLAPI void ImageApplyPipeline(Image *image, ImagePipeline pipeline);                                     // Apply all image pipeline operations to image
+
 // Image drawing functions
 // NOTE: Image software-rendering functions (CPU)
 RLAPI void ImageClearBackground(Image *dst, Color color);                                                // Clear image background with given color
@@ -1420,6 +1512,19 @@ RLAPI void UnloadRenderTexture(RenderTexture2D target);
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
 
+// Texture loading queue functions
+// NOTE: Images are decoded on worker threads, textures are uploaded by UpdateTextureQueue()
+RLAPI Texture2D LoadTextureAsync(const char *fileName);                                                  // Load texture from file into GPU memory (VRAM), decoding it in the background (placeholder until uploaded)
+RLAPI void UpdateTextureQueue(float budget);                                                             // Upload decoded textures of the loading queue, for up to budget milliseconds (call once per frame)
+RLAPI bool IsTextureQueued(Texture2D texture);                                                           // Check if a texture is waiting in the loading queue (placeholder not uploaded yet)
+RLAPI int GetTextureQueueCount(void);                                                                    // Get number of textures waiting in the loading queue
+
+// Texture atlas functions
+// NOTE: Draw atlas images with DrawTextureRec(atlas.pages[region.page], region.rec, ...), draws sharing a page are batched
+RLAPI TextureAtlas LoadTextureAtlas(int width, int height, int padding);                                 // Load an empty texture atlas, pages are added as required
+RLAPI AtlasRegion AddTextureAtlasImage(TextureAtlas *atlas, Image image);                                 // Pack image into a texture atlas, returns its region
+RLAPI void UnloadTextureAtlas(TextureAtlas atlas);                                                       // Unload texture atlas pages from GPU memory (VRAM)
+
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
 RLAPI void SetTextureFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
@@ -1471,6 +1576,7 @@ RLAPI bool ExportFontAsCode(Font font, const char *fileName);
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
+RLAPI void DrawFrameStats(int posX, int posY);                                              // Draw frame stats breakdown (averaged)
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
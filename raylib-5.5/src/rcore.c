@@ -253,6 +253,10 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef MAX_FRAME_STATS
+    #define MAX_FRAME_STATS              240        // Maximum number of frames stats kept (ring buffer)
+#endif
+
 #ifndef DIRECTORY_FILTER_TAG
     #define DIRECTORY_FILTER_TAG       "DIR"        // Name tag used to request directory inclusion on directory scan
 #endif                                              // NOTE: Used in ScanDirectoryFiles(), ScanDirectoryFilesRecursively() and LoadDirectoryFilesEx()
@@ -387,6 +391,14 @@ static bool gifRecording = false;           // GIF recording state
 static MsfGifState gifState = { 0 };        // MSGIF context state
 #endif
 
+#if defined(SUPPORT_FRAME_STATS)
+static FrameStats frameStats[MAX_FRAME_STATS] = { 0 };  // Frames stats history (ring buffer)
+static int frameStatsIndex = 0;             // Next frame stats position on ring buffer
+static int frameStatsCount = 0;             // Frames stats available (up to MAX_FRAME_STATS)
+static float frameStatsPollTime = 0.0f;     // Previous frame PollInputEvents() time, counted by CORE.Time.update
+static rlBatchStats frameStatsBatch = { 0 }; // rlgl batch stats at previous frame end, to get per-frame values
+#endif
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 // Automation events type
 typedef enum AutomationEventType {
@@ -485,6 +497,10 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+extern void UnloadTextureQueue(void);   // [Module: textures] Stops texture loading queue workers and drops queued textures
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
 
@@ -499,6 +515,10 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(SUPPORT_FRAME_STATS)
+static void RecordFrameStats(double drawTime, double swapTime, double waitTime, double pollTime); // Record frame stats (to internal ring buffer)
+#endif
+
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -734,6 +754,10 @@ void CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UnloadTextureQueue();       // WARNING: Module required: rtextures
+#endif
+
     rlglClose();                // De-init rlgl
 
     // De-initialize platform
@@ -929,10 +953,18 @@ void EndDrawing(void)
     }
 #endif
 
+    rlUpdateRenderBatchLimits();    // Fit default render batch size to recent frames usage
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
 
+#if defined(SUPPORT_FRAME_STATS)
+    double drawEndTime = GetTime();
+    double statsDrawTime = drawEndTime - CORE.Time.previous;    // CORE.Time.previous was set on BeginDrawing()
+    double statsSwapTime = 0.0, statsWaitTime = 0.0, statsPollTime = 0.0;
+#endif
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
@@ -943,6 +975,10 @@ void EndDrawing(void)
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
+#if defined(SUPPORT_FRAME_STATS)
+    statsSwapTime = CORE.Time.current - drawEndTime;
+#endif
+
     // Wait for some milliseconds...
     if (CORE.Time.frame < CORE.Time.target)
     {
@@ -953,9 +989,22 @@ void EndDrawing(void)
         CORE.Time.previous = CORE.Time.current;
 
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+
+#if defined(SUPPORT_FRAME_STATS)
+        statsWaitTime = waitTime;
+#endif
     }
 
     PollInputEvents();      // Poll user events (before next frame update)
+
+#if defined(SUPPORT_FRAME_STATS)
+    statsPollTime = GetTime() - CORE.Time.previous;
+#endif
+#endif
+
+#if defined(SUPPORT_FRAME_STATS)
+    // NOTE: With SUPPORT_CUSTOM_FRAME_CONTROL, swap, wait and poll happen out of EndDrawing() and are not measured
+    RecordFrameStats(statsDrawTime, statsSwapTime, statsWaitTime, statsPollTime);
 #endif
 
 #if defined(SUPPORT_SCREEN_CAPTURE)
@@ -1002,7 +1051,7 @@ void EndDrawing(void)
 // Initialize 2D mode with custom camera (2D)
 void BeginMode2D(Camera2D camera)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_FLUSH_MATRIX);  // Update and draw internal render batch
 
     rlLoadIdentity();               // Reset current matrix (modelview)
 
@@ -1013,7 +1062,7 @@ void BeginMode2D(Camera2D camera)
 // Ends 2D mode with custom camera
 void EndMode2D(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_FLUSH_MATRIX);  // Update and draw internal render batch
 
     rlLoadIdentity();               // Reset current matrix (modelview)
 
@@ -1023,7 +1072,7 @@ void EndMode2D(void)
 // Initializes 3D mode with custom camera (3D)
 void BeginMode3D(Camera camera)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_FLUSH_MATRIX);  // Update and draw internal render batch
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPushMatrix();                 // Save previous matrix, which contains the settings for the 2d ortho projection
@@ -1062,7 +1111,7 @@ void BeginMode3D(Camera camera)
 // Ends 3D mode and returns to default 2D orthographic mode
 void EndMode3D(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_FLUSH_MATRIX);  // Update and draw internal render batch
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPopMatrix();                  // Restore previous matrix (projection) from matrix stack
@@ -1078,7 +1127,7 @@ void EndMode3D(void)
 // Initializes render texture for drawing
 void BeginTextureMode(RenderTexture2D target)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_FLUSH_MATRIX);  // Update and draw internal render batch
 
     rlEnableFramebuffer(target.id); // Enable render target
 
@@ -1109,7 +1158,7 @@ void BeginTextureMode(RenderTexture2D target)
 // Ends drawing to render texture
 void EndTextureMode(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_FLUSH_MATRIX);  // Update and draw internal render batch
 
     rlDisableFramebuffer();         // Disable render target (fbo)
 
@@ -1156,7 +1205,7 @@ void EndBlendMode(void)
 // NOTE: Scissor rec refers to bottom-left corner, we change it to upper-left
 void BeginScissorMode(int x, int y, int width, int height)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_FLUSH_STATE);   // Update and draw internal render batch
 
     rlEnableScissorTest();
 
@@ -1182,10 +1231,31 @@ void BeginScissorMode(int x, int y, int width, int height)
 // End scissor mode
 void EndScissorMode(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlDrawRenderBatchActiveEx(RL_FLUSH_STATE);   // Update and draw internal render batch
     rlDisableScissorTest();
 }
 
+// Begin sorted mode
+// NOTE: Draws are submitted grouped by layer, texture and shape type (lines, triangles, quads) when
+// the batch is drawn, every group is drawn in order of first use, keeping its draws order,
+// useful when shapes and text are interleaved, as every texture change is a new draw call
+void BeginSortedMode(void)
+{
+    rlEnableDrawSorting();
+}
+
+// End sorted mode
+void EndSortedMode(void)
+{
+    rlDisableDrawSorting();
+}
+
+// Set layer for next draws in sorted mode, lower layers are drawn first
+void SetDrawLayer(int layer)
+{
+    rlSetDrawLayer(layer);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: VR Stereo Rendering
 //----------------------------------------------------------------------------------
@@ -1699,6 +1769,63 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Get stats for a recent frame (0 = last finished frame)
+// NOTE: framesAgo must be lower than GetFrameStatsCount(), an empty FrameStats is returned otherwise
+FrameStats GetFrameStats(int framesAgo)
+{
+    FrameStats stats = { 0 };
+
+#if defined(SUPPORT_FRAME_STATS)
+    if ((framesAgo >= 0) && (framesAgo < frameStatsCount))
+    {
+        stats = frameStats[(frameStatsIndex - 1 - framesAgo + MAX_FRAME_STATS)%MAX_FRAME_STATS];
+    }
+#endif
+
+    return stats;
+}
+
+// Get number of frames stats available
+int GetFrameStatsCount(void)
+{
+#if defined(SUPPORT_FRAME_STATS)
+    return frameStatsCount;
+#else
+    return 0;
+#endif
+}
+
+// Export frames stats as CSV, oldest frame first, times in milliseconds
+bool ExportFrameStats(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FRAME_STATS)
+    char *txtData = (char *)RL_CALLOC(256*frameStatsCount + 256, sizeof(char)); // 256 characters per line plus header
+
+    int byteCount = 0;
+    byteCount += sprintf(txtData + byteCount, "frame,update_ms,draw_ms,swap_ms,wait_ms,poll_ms,frame_ms,draw_calls,vertex_count,flush_count\n");
+
+    for (int i = frameStatsCount - 1; i >= 0; i--)
+    {
+        FrameStats stats = GetFrameStats(i);
+        byteCount += snprintf(txtData + byteCount, 256, "%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%u,%u,%u\n", stats.frame,
+            stats.updateTime*1000.0f, stats.drawTime*1000.0f, stats.swapTime*1000.0f, stats.waitTime*1000.0f, stats.pollTime*1000.0f,
+            stats.frameTime*1000.0f, stats.drawCalls, stats.vertexCount, stats.flushCount);
+    }
+
+    // NOTE: Text data size exported is determined by '\0' (NULL) character
+    success = SaveFileText(fileName, txtData);
+
+    RL_FREE(txtData);
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Frame stats exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export frame stats", fileName);
+
+    return success;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Custom frame control
 //----------------------------------------------------------------------------------
@@ -4029,6 +4156,40 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+#if defined(SUPPORT_FRAME_STATS)
+// Record frame stats into the ring buffer
+// NOTE: Called at EndDrawing(), rlgl counters include everything drawn since previous EndDrawing(),
+// render textures drawn before BeginDrawing() included
+static void RecordFrameStats(double drawTime, double swapTime, double waitTime, double pollTime)
+{
+    FrameStats *stats = &frameStats[frameStatsIndex];
+    rlBatchStats batch = rlGetBatchStats();
+
+    stats->frame = CORE.Time.frameCounter;
+
+    // CORE.Time.update also counts previous frame PollInputEvents(), already reported as pollTime
+    stats->updateTime = (float)CORE.Time.update - frameStatsPollTime;
+    if (stats->updateTime < 0.0f) stats->updateTime = 0.0f;
+    stats->drawTime = (float)drawTime;
+    stats->swapTime = (float)swapTime;
+    stats->waitTime = (float)waitTime;
+    stats->pollTime = (float)pollTime;
+    stats->frameTime = stats->updateTime + stats->drawTime + stats->swapTime + stats->waitTime + stats->pollTime;
+
+    // NOTE: Unsigned difference is correct even if counters wrapped around,
+    // values for the frame where user called rlResetBatchStats() are not valid
+    stats->drawCalls = batch.drawCallCount - frameStatsBatch.drawCallCount;
+    stats->vertexCount = batch.vertexCount - frameStatsBatch.vertexCount;
+    stats->flushCount = batch.flushCount - frameStatsBatch.flushCount;
+
+    frameStatsBatch = batch;
+    frameStatsPollTime = (float)pollTime;
+
+    frameStatsIndex = (frameStatsIndex + 1)%MAX_FRAME_STATS;
+    if (frameStatsCount < MAX_FRAME_STATS) frameStatsCount++;
+}
+#endif
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
@@ -50,9 +50,12 @@
 *       values before library inclusion (default values listed):
 *
 *       #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
-*       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
+*       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering, persistent mapped streaming on GL 4.4 if > 1)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_MAX_BATCH_BUFFER_ELEMENTS      65536    // Maximum elements the default batch can grow to (rlUpdateRenderBatchLimits())
+*       #define RL_MAX_BATCH_DRAWCALLS            16384    // Maximum draw calls the default batch can grow to (rlUpdateRenderBatchLimits())
+*       #define RL_BATCH_USAGE_FRAMES               120    // Frames of default batch usage history considered to grow/shrink it
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
@@ -222,6 +225,22 @@
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
 
+// Default render batch growth limits, see rlUpdateRenderBatchLimits()
+// NOTE: Set them to the RL_DEFAULT_BATCH_* values to keep the default batch size fixed
+#ifndef RL_MAX_BATCH_BUFFER_ELEMENTS
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+        #define RL_MAX_BATCH_BUFFER_ELEMENTS     16384      // Maximum elements (quads) the default batch can grow to, 16 bit indices limit
+    #else
+        #define RL_MAX_BATCH_BUFFER_ELEMENTS     65536      // Maximum elements (quads) the default batch can grow to
+    #endif
+#endif
+#ifndef RL_MAX_BATCH_DRAWCALLS
+    #define RL_MAX_BATCH_DRAWCALLS               16384      // Maximum draw calls the default batch can grow to
+#endif
+#ifndef RL_BATCH_USAGE_FRAMES
+    #define RL_BATCH_USAGE_FRAMES                  120      // Frames of default batch usage history considered to grow/shrink it
+#endif
+
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
     #define RL_MAX_MATRIX_STACK_SIZE                32      // Maximum size of Matrix stack
@@ -393,6 +412,8 @@ typedef struct rlVertexBuffer {
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    bool persistentMapped;      // Vertex arrays point to persistently mapped VBOs memory (streaming, GL 4.4 or GL_ARB_buffer_storage)
+    void *syncFence;            // Fence (GLsync) signaled when the GPU is done with the last draw from this buffer (persistent mapped only)
 } rlVertexBuffer;
 
 // Draw call type
@@ -406,6 +427,7 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    int layer;                  // Draw layer, only used with draw sorting enabled (rlEnableDrawSorting())
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -418,10 +440,28 @@ typedef struct rlRenderBatch {
     rlVertexBuffer *vertexBuffer; // Dynamic buffer(s) for vertex data
 
     rlDrawCall *draws;          // Draw calls array, depends on textureId
+    int drawCapacity;           // Draw calls array size (RL_DEFAULT_BATCH_DRAWCALLS, the default batch can grow)
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Render batch statistics, accumulated until rlResetBatchStats()
+// NOTE: Only flushes that uploaded vertex data are counted, flushing an empty batch is free
+typedef struct rlBatchStats {
+    unsigned int flushCount;    // Render batch flushes that uploaded vertex data (sum of all flush reasons)
+    unsigned int flushVertexLimit;   // Flushes because the batch vertex buffer was full
+    unsigned int flushDrawCallLimit; // Flushes because a primitive mode change needed a draw call and all were used
+    unsigned int flushTexture;  // Flushes because a texture switch needed a draw call and all were used
+    unsigned int flushMatrix;   // Flushes before a projection/modelview change (BeginMode2D(), BeginTextureMode()...)
+    unsigned int flushState;    // Flushes on shader, blend mode, scissor or active render batch changes
+    unsigned int flushExplicit; // Flushes requested with rlDrawRenderBatch()/rlDrawRenderBatchActive() (EndDrawing()...)
+    unsigned int drawCallCount; // OpenGL draw calls issued (glDrawArrays()/glDrawElements())
+    unsigned int vertexCount;   // Vertex uploaded to GPU buffers
+    unsigned int indexCount;    // Indices drawn for quads (index buffer is static, uploaded once on batch loading)
+    unsigned int byteCount;     // Bytes uploaded to GPU vertex buffers (positions, texcoords, normals, colors)
+    unsigned int syncWaitCount; // Times the CPU had to wait for the GPU to release a persistent mapped buffer
+} rlBatchStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -589,6 +629,16 @@ typedef enum {
     RL_CULL_FACE_BACK
 } rlCullMode;
 
+// Render batch flush reasons (rlBatchStats)
+typedef enum {
+    RL_FLUSH_EXPLICIT = 0,          // rlDrawRenderBatch()/rlDrawRenderBatchActive() called directly
+    RL_FLUSH_VERTEX_LIMIT,          // Batch vertex buffer full (rlCheckRenderBatchLimit())
+    RL_FLUSH_DRAWCALL_LIMIT,        // All batch draw calls used on a primitive mode change (rlBegin())
+    RL_FLUSH_TEXTURE,               // All batch draw calls used on a texture switch (rlSetTexture())
+    RL_FLUSH_MATRIX,                // Projection/modelview change
+    RL_FLUSH_STATE                  // Shader, blend mode, scissor or active render batch change
+} rlFlushReason;
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -724,9 +774,16 @@ RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);    // Unload render batch s
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch data (Update->Draw->Reset)
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
+RLAPI void rlDrawRenderBatchActiveEx(int reason);       // Update and draw internal render batch, counting the flush under a reason (rlFlushReason)
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
+RLAPI void rlUpdateRenderBatchLimits(void);             // Grow/shrink default render batch to fit recent frames usage (once per frame, after drawing)
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
+RLAPI void rlEnableDrawSorting(void);                   // Enable draw sorting: batch draws grouped by layer, texture and mode on submission
+RLAPI void rlDisableDrawSorting(void);                  // Disable draw sorting (draws submitted in call order)
+RLAPI void rlSetDrawLayer(int layer);                   // Set layer for next draws, lower layers drawn first (draw sorting only)
+RLAPI rlBatchStats rlGetBatchStats(void);               // Get render batch statistics (flushes by reason, draw calls, vertex, bytes)
+RLAPI void rlResetBatchStats(void);                     // Reset render batch statistics
 
 //------------------------------------------------------------------------------------------------------------------------
 
@@ -780,6 +837,7 @@ RLAPI void rlSetShader(unsigned int id, int *locs);
 // Compute shader management
 RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);           // Load compute shader program
 RLAPI void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ); // Dispatch compute shader (equivalent to *draw* for graphics pipeline)
+RLAPI void rlComputeShaderBarrier(void);                                         // Make SSBO writes of previous dispatches visible to later dispatches, draws and buffer reads
 
 // Shader buffer storage object management (ssbo)
 RLAPI unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint); // Load shader storage buffer object (SSBO)
@@ -1034,6 +1092,14 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Draw call reference for draw sorting
+typedef struct rlSortedDraw {
+    int layer;                      // Draw layer
+    int group;                      // First draw in the layer with the same texture and mode
+    int index;                      // Draw index in the batch (keeps call order inside a group)
+    int vertexOffset;               // First vertex of the draw in the batch vertex buffer
+} rlSortedDraw;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
@@ -1082,6 +1148,10 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        int flushReason;                    // Reason for the next render batch flush (rlFlushReason), reset after every flush
+        bool drawSorting;                   // Draw sorting enabled: batch draws grouped by layer, texture and mode on submission
+        int drawLayer;                      // Current draw layer, assigned to new draws (draw sorting)
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
@@ -1100,11 +1170,25 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Immutable buffer storage and persistent mapping support (GL_ARB_buffer_storage, core on GL 4.4)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+
+    rlBatchStats Stats;     // Render batch statistics
+
+    struct {
+        int runVertex;                      // Vertex drawn since the last flush not forced by the batch limits
+        int runDraws;                       // Draw calls since the last flush not forced by the batch limits
+        int frameVertex;                    // Current frame peak run vertex
+        int frameDraws;                     // Current frame peak run draw calls
+        int peakVertex[RL_BATCH_USAGE_FRAMES];  // Recent frames peak run vertex (ring buffer)
+        int peakDraws[RL_BATCH_USAGE_FRAMES];   // Recent frames peak run draw calls (ring buffer)
+        int frameIndex;                     // Next ring buffer position
+        int frameCount;                     // Frames recorded since the last resize (up to RL_BATCH_USAGE_FRAMES)
+    } BatchUsage;       // Default render batch usage, to fit its size (rlUpdateRenderBatchLimits())
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1139,6 +1223,8 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void *rlLoadBatchVertexData(int size, const void *data, bool persistent); // Load render batch vertex data into the VBO bound to GL_ARRAY_BUFFER
+static void rlDrawRenderBatchSorted(rlRenderBatch *batch); // Draw render batch draw calls grouped by layer, texture and mode (draw sorting)
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
@@ -1470,11 +1556,16 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawCounter >= RLGL.currentBatch->drawCapacity)
+        {
+            RLGL.State.flushReason = RL_FLUSH_DRAWCALL_LIMIT;
+            rlDrawRenderBatch(RLGL.currentBatch);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
     }
 }
 
@@ -1637,6 +1728,7 @@ void rlSetTexture(unsigned int id)
         if (RLGL.State.vertexCounter >=
             RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)
         {
+            RLGL.State.flushReason = RL_FLUSH_VERTEX_LIMIT;
             rlDrawRenderBatch(RLGL.currentBatch);
         }
 #endif
@@ -1667,10 +1759,15 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLGL.currentBatch->drawCounter >= RLGL.currentBatch->drawCapacity)
+            {
+                RLGL.State.flushReason = RL_FLUSH_TEXTURE;
+                rlDrawRenderBatch(RLGL.currentBatch);
+            }
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
         }
 #endif
     }
@@ -2097,6 +2194,7 @@ void rlSetBlendMode(int mode)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
+        RLGL.State.flushReason = RL_FLUSH_STATE;
         rlDrawRenderBatch(RLGL.currentBatch);
 
         switch (mode)
@@ -2391,6 +2489,7 @@ void rlLoadExtensions(void *loader)
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage;
     #endif
 
 #endif  // GRAPHICS_API_OPENGL_33
@@ -2623,6 +2722,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(RL_LOG_INFO, "GL: Persistent mapped buffers supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2772,9 +2872,19 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     //--------------------------------------------------------------------------------------------
 
     // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
+    // NOTE: With multiple buffers and persistent mapping support, vertex data is streamed: the vertex arrays
+    // are replaced by the mapped VBOs memory, so rlVertex3f() writes straight to GPU memory and no upload is
+    // needed on rlDrawRenderBatch(), fences make sure a buffer is not written while the GPU is reading it
     //--------------------------------------------------------------------------------------------
+    bool persistent = (numBuffers > 1) && RLGL.ExtSupported.bufferStorage;
+
     for (int i = 0; i < numBuffers; i++)
     {
+        void *mapped[4] = { 0 };
+
+        batch.vertexBuffer[i].persistentMapped = false;
+        batch.vertexBuffer[i].syncFence = NULL;
+
         if (RLGL.ExtSupported.vao)
         {
             // Initialize Quads VAO
@@ -2786,28 +2896,28 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+        mapped[0] = rlLoadBatchVertexData(bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, persistent);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 
         // Vertex texcoord buffer (shader-location = 1)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+        mapped[1] = rlLoadBatchVertexData(bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, persistent);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
 
         // Vertex normal buffer (shader-location = 2)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
+        mapped[2] = rlLoadBatchVertexData(bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, persistent);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
 
         // Vertex color buffer (shader-location = 3)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+        mapped[3] = rlLoadBatchVertexData(bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, persistent);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
 
@@ -2820,9 +2930,40 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #if defined(GRAPHICS_API_OPENGL_ES2)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
 #endif
+
+        if (persistent && (mapped[0] != NULL) && (mapped[1] != NULL) && (mapped[2] != NULL) && (mapped[3] != NULL))
+        {
+            // Vertex data lives in the mapped VBOs from now on, CPU copies are not required
+            RL_FREE(batch.vertexBuffer[i].vertices);
+            RL_FREE(batch.vertexBuffer[i].texcoords);
+            RL_FREE(batch.vertexBuffer[i].normals);
+            RL_FREE(batch.vertexBuffer[i].colors);
+
+            batch.vertexBuffer[i].vertices = (float *)mapped[0];
+            batch.vertexBuffer[i].texcoords = (float *)mapped[1];
+            batch.vertexBuffer[i].normals = (float *)mapped[2];
+            batch.vertexBuffer[i].colors = (unsigned char *)mapped[3];
+            batch.vertexBuffer[i].persistentMapped = true;
+        }
+        else if (persistent)
+        {
+            // NOTE: Buffers storage is created with GL_DYNAMIC_STORAGE_BIT, so glBufferSubData() uploads keep working
+            TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffers, using regular uploads");
+#if defined(GRAPHICS_API_OPENGL_43)
+            for (int k = 0; k < 4; k++)
+            {
+                if (mapped[k] != NULL)
+                {
+                    glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[k]);
+                    glUnmapBuffer(GL_ARRAY_BUFFER);
+                }
+            }
+#endif
+        }
     }
 
-    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    if (batch.vertexBuffer[0].persistentMapped) TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU), %i persistent mapped buffers", numBuffers);
+    else TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2840,11 +2981,13 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].layer = RLGL.State.drawLayer;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
 
     batch.bufferCount = numBuffers;    // Record buffer count
+    batch.drawCapacity = RL_DEFAULT_BATCH_DRAWCALLS;    // Record draw calls array size
     batch.drawCounter = 1;             // Reset draws counter
     batch.currentDepth = -1.0f;         // Reset depth value
     //--------------------------------------------------------------------------------------------
@@ -2885,11 +3028,19 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
+#if defined(GRAPHICS_API_OPENGL_43)
+        if (batch.vertexBuffer[i].syncFence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].syncFence);
+#endif
+
         // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].normals);
-        RL_FREE(batch.vertexBuffer[i].colors);
+        // NOTE: Persistent mapped arrays are unmapped by glDeleteBuffers()
+        if (!batch.vertexBuffer[i].persistentMapped)
+        {
+            RL_FREE(batch.vertexBuffer[i].vertices);
+            RL_FREE(batch.vertexBuffer[i].texcoords);
+            RL_FREE(batch.vertexBuffer[i].normals);
+            RL_FREE(batch.vertexBuffer[i].colors);
+        }
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2904,34 +3055,67 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Track default batch usage: consecutive flushes forced by the batch limits are
+    // a run of drawing that would have fit in a single flush of a bigger batch
+    if (batch == &RLGL.defaultBatch)
+    {
+        RLGL.BatchUsage.runVertex += RLGL.State.vertexCounter;
+        RLGL.BatchUsage.runDraws += batch->drawCounter;
+        if (RLGL.BatchUsage.runVertex > RLGL.BatchUsage.frameVertex) RLGL.BatchUsage.frameVertex = RLGL.BatchUsage.runVertex;
+        if (RLGL.BatchUsage.runDraws > RLGL.BatchUsage.frameDraws) RLGL.BatchUsage.frameDraws = RLGL.BatchUsage.runDraws;
+
+        if ((RLGL.State.flushReason != RL_FLUSH_VERTEX_LIMIT) && (RLGL.State.flushReason != RL_FLUSH_DRAWCALL_LIMIT) && (RLGL.State.flushReason != RL_FLUSH_TEXTURE))
+        {
+            RLGL.BatchUsage.runVertex = 0;
+            RLGL.BatchUsage.runDraws = 0;
+        }
+    }
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
     if (RLGL.State.vertexCounter > 0)
     {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+        RLGL.Stats.flushCount++;
+        switch (RLGL.State.flushReason)
+        {
+            case RL_FLUSH_VERTEX_LIMIT: RLGL.Stats.flushVertexLimit++; break;
+            case RL_FLUSH_DRAWCALL_LIMIT: RLGL.Stats.flushDrawCallLimit++; break;
+            case RL_FLUSH_TEXTURE: RLGL.Stats.flushTexture++; break;
+            case RL_FLUSH_MATRIX: RLGL.Stats.flushMatrix++; break;
+            case RL_FLUSH_STATE: RLGL.Stats.flushState++; break;
+            default: RLGL.Stats.flushExplicit++; break;
+        }
+        RLGL.Stats.vertexCount += RLGL.State.vertexCounter;
+        RLGL.Stats.byteCount += RLGL.State.vertexCounter*(3*sizeof(float) + 2*sizeof(float) + 3*sizeof(float) + 4*sizeof(unsigned char));
 
-        // Normals buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
+        // NOTE: Persistent mapped buffers already have the vertex data in GPU memory (rlVertex3f() writes it there)
+        if (!batch->vertexBuffer[batch->currentBuffer].persistentMapped)
+        {
+            // Activate elements VAO
+            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+
+            // Texture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+
+            // Normals buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
+
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+        }
 
         // NOTE: glMapBuffer() causes sync issue
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job
@@ -3052,26 +3236,33 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
 
-            for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+            if (RLGL.State.drawSorting) rlDrawRenderBatchSorted(batch);
+            else
             {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
-
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
-                else
+                for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
                 {
+                    // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+
+                    if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
+                    else
+                    {
+                        RLGL.Stats.indexCount += batch->draws[i].vertexCount/4*6;
     #if defined(GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: elementCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+                        // We need to define the number of indices to be processed: elementCount*6
+                        // NOTE: The final parameter tells the GPU the offset in bytes from the
+                        // start of the index buffer to the location of the first index to process
+                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
     #endif
     #if defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
+                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
     #endif
+                    }
+
+                    vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
                 }
 
-                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+                RLGL.Stats.drawCallCount += batch->drawCounter;
             }
 
             if (!RLGL.ExtSupported.vao)
@@ -3092,11 +3283,22 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
     //------------------------------------------------------------------------------------------------------------
 
+#if defined(GRAPHICS_API_OPENGL_43)
+    // Fence the persistent mapped buffer just drawn, it can not be written again until the GPU is done with it
+    if (batch->vertexBuffer[batch->currentBuffer].persistentMapped && (RLGL.State.vertexCounter > 0))
+    {
+        batch->vertexBuffer[batch->currentBuffer].syncFence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
+
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
     // Reset vertex counter for next frame
     RLGL.State.vertexCounter = 0;
 
+    // Reset flush reason, next flush is explicit unless its caller says otherwise
+    RLGL.State.flushReason = RL_FLUSH_EXPLICIT;
+
     // Reset depth for next draw
     batch->currentDepth = -1.0f;
 
@@ -3105,11 +3307,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     RLGL.State.modelview = matModelView;
 
     // Reset RLGL.currentBatch->draws array
-    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    for (int i = 0; i < batch->drawCapacity; i++)
     {
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.drawLayer;
     }
 
     // Reset active texture units for next batch
@@ -3122,6 +3325,25 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    // Wait for the GPU to finish reading the next buffer before new vertex data is written to it
+    // NOTE: With enough buffers the fence is already signaled and this never blocks
+    if (batch->vertexBuffer[batch->currentBuffer].syncFence != NULL)
+    {
+        GLsync fence = (GLsync)batch->vertexBuffer[batch->currentBuffer].syncFence;
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+        if ((result == GL_TIMEOUT_EXPIRED) || (result == GL_CONDITION_SATISFIED))
+        {
+            RLGL.Stats.syncWaitCount++;
+            while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);  // 1 ms timeout
+        }
+
+        glDeleteSync(fence);
+        batch->vertexBuffer[batch->currentBuffer].syncFence = NULL;
+    }
+#endif
 #endif
 }
 
@@ -3129,6 +3351,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 void rlSetRenderBatchActive(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.flushReason = RL_FLUSH_STATE;
     rlDrawRenderBatch(RLGL.currentBatch);
 
     if (batch != NULL) RLGL.currentBatch = batch;
@@ -3144,6 +3367,16 @@ void rlDrawRenderBatchActive(void)
 #endif
 }
 
+// Update and draw internal render batch, counting the flush under a reason (rlFlushReason)
+// NOTE: Used by raylib to tell matrix and state flushes apart from explicit ones in rlBatchStats
+void rlDrawRenderBatchActiveEx(int reason)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.flushReason = reason;
+    rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+#endif
+}
+
 // Check internal buffer overflow for a given number of vertex
 // and force a rlRenderBatch draw call if required
 bool rlCheckRenderBatchLimit(int vCount)
@@ -3160,6 +3393,7 @@ bool rlCheckRenderBatchLimit(int vCount)
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
         int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
 
+        RLGL.State.flushReason = RL_FLUSH_VERTEX_LIMIT;
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
@@ -3171,6 +3405,190 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+// Grow/shrink default render batch to fit recent frames usage
+// NOTE: Call it once per frame, after the frame batch has been drawn (EndDrawing() does it),
+// the batch grows right away if a frame needed several flushes only because of its limits,
+// up to RL_MAX_BATCH_BUFFER_ELEMENTS/RL_MAX_BATCH_DRAWCALLS, and shrinks back (never below the
+// RL_DEFAULT_BATCH_* sizes) once no frame in the last RL_BATCH_USAGE_FRAMES needed a quarter of it
+void rlUpdateRenderBatchLimits(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.BatchUsage.peakVertex[RLGL.BatchUsage.frameIndex] = RLGL.BatchUsage.frameVertex;
+    RLGL.BatchUsage.peakDraws[RLGL.BatchUsage.frameIndex] = RLGL.BatchUsage.frameDraws;
+    RLGL.BatchUsage.frameIndex = (RLGL.BatchUsage.frameIndex + 1)%RL_BATCH_USAGE_FRAMES;
+    if (RLGL.BatchUsage.frameCount < RL_BATCH_USAGE_FRAMES) RLGL.BatchUsage.frameCount++;
+    RLGL.BatchUsage.frameVertex = 0;
+    RLGL.BatchUsage.frameDraws = 0;
+    RLGL.BatchUsage.runVertex = 0;
+    RLGL.BatchUsage.runDraws = 0;
+
+    // Batch must be empty to be resized, it is not if drawing continued after last flush
+    if ((RLGL.State.vertexCounter > 0) || (RLGL.defaultBatch.drawCounter > 1)) return;
+
+    int peakVertex = 0;
+    int peakDraws = 0;
+    for (int i = 0; i < RLGL.BatchUsage.frameCount; i++)
+    {
+        if (RLGL.BatchUsage.peakVertex[i] > peakVertex) peakVertex = RLGL.BatchUsage.peakVertex[i];
+        if (RLGL.BatchUsage.peakDraws[i] > peakDraws) peakDraws = RLGL.BatchUsage.peakDraws[i];
+    }
+
+    // Sizes that fit the peak in a single flush: power of two, with room for the limit checks (>=)
+    int elements = RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+    while ((elements < RL_MAX_BATCH_BUFFER_ELEMENTS) && (elements*4 <= peakVertex)) elements *= 2;
+    if (elements > RL_MAX_BATCH_BUFFER_ELEMENTS) elements = RL_MAX_BATCH_BUFFER_ELEMENTS;
+
+    int drawCalls = RL_DEFAULT_BATCH_DRAWCALLS;
+    while ((drawCalls < RL_MAX_BATCH_DRAWCALLS) && (drawCalls <= peakDraws)) drawCalls *= 2;
+    if (drawCalls > RL_MAX_BATCH_DRAWCALLS) drawCalls = RL_MAX_BATCH_DRAWCALLS;
+
+    int currentElements = RLGL.defaultBatch.vertexBuffer[0].elementCount;
+    int currentDrawCalls = RLGL.defaultBatch.drawCapacity;
+
+    // Grow as soon as required, shrink only with a full history that needed a quarter of current size
+    bool fullHistory = (RLGL.BatchUsage.frameCount == RL_BATCH_USAGE_FRAMES);
+    if ((elements < currentElements) && (!fullHistory || (elements > currentElements/4))) elements = currentElements;
+    if ((drawCalls < currentDrawCalls) && (!fullHistory || (drawCalls > currentDrawCalls/4))) drawCalls = currentDrawCalls;
+
+    if ((elements == currentElements) && (drawCalls == currentDrawCalls)) return;
+
+    if (elements != currentElements)
+    {
+        // Default batch vertex buffers are loaded with the default shader locations, normals included
+        int *currentShaderLocs = RLGL.State.currentShaderLocs;
+        RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
+        RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL;
+
+        int bufferCount = RLGL.defaultBatch.bufferCount;
+        rlUnloadRenderBatch(RLGL.defaultBatch);
+        RLGL.defaultBatch = rlLoadRenderBatch(bufferCount, elements);
+
+        RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = -1;
+        RLGL.State.currentShaderLocs = currentShaderLocs;
+    }
+
+    if (drawCalls != RLGL.defaultBatch.drawCapacity)
+    {
+        RLGL.defaultBatch.draws = (rlDrawCall *)RL_REALLOC(RLGL.defaultBatch.draws, drawCalls*sizeof(rlDrawCall));
+
+        for (int i = 0; i < drawCalls; i++)
+        {
+            RLGL.defaultBatch.draws[i].mode = RL_QUADS;
+            RLGL.defaultBatch.draws[i].vertexCount = 0;
+            RLGL.defaultBatch.draws[i].vertexAlignment = 0;
+            RLGL.defaultBatch.draws[i].textureId = RLGL.State.defaultTextureId;
+            RLGL.defaultBatch.draws[i].layer = RLGL.State.drawLayer;
+        }
+
+        RLGL.defaultBatch.drawCapacity = drawCalls;
+    }
+
+    RLGL.BatchUsage.frameCount = 0;
+    RLGL.BatchUsage.frameIndex = 0;
+
+    TRACELOG(RL_LOG_INFO, "RLGL: Default render batch resized to %i elements, %i draw calls", elements, drawCalls);
+#endif
+}
+
+// Enable draw sorting
+// NOTE: Until disabled, every batch flush submits its draws grouped by (layer, texture, mode) instead of in call
+// order: layers go from lower to higher and, inside a layer, groups go in order of first use, so draws sharing
+// texture and mode keep their call order but can end up above/below draws of other groups in the same layer.
+// Shaders and other state changes still flush the batch, so they keep call order
+void rlEnableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.drawSorting)
+    {
+        RLGL.State.flushReason = RL_FLUSH_STATE;
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.drawSorting = true;
+    }
+#endif
+}
+
+// Disable draw sorting
+void rlDisableDrawSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.drawSorting)
+    {
+        RLGL.State.flushReason = RL_FLUSH_STATE;
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.drawSorting = false;
+        rlSetDrawLayer(0);
+    }
+#endif
+}
+
+// Set layer for next draws, lower layers drawn first (draw sorting only)
+void rlSetDrawLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.drawLayer == layer) return;
+
+    RLGL.State.drawLayer = layer;
+
+    // NOTE: Without draw sorting layers are ignored, no need to split draw calls
+    if (!RLGL.State.drawSorting) return;
+
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (draw->vertexCount > 0)
+    {
+        // Close current draw call, aligned as on texture changes (see rlSetTexture())
+        int mode = draw->mode;
+        unsigned int textureId = draw->textureId;
+
+        if (mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+        else if (mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+        else draw->vertexAlignment = 0;
+
+        if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+        {
+            RLGL.State.vertexCounter += draw->vertexAlignment;
+            RLGL.currentBatch->drawCounter++;
+        }
+
+        if (RLGL.currentBatch->drawCounter >= RLGL.currentBatch->drawCapacity)
+        {
+            RLGL.State.flushReason = RL_FLUSH_DRAWCALL_LIMIT;
+            rlDrawRenderBatch(RLGL.currentBatch);
+        }
+
+        // New draw call keeps mode and texture
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = textureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+    }
+
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = layer;
+#endif
+}
+
+// Get render batch statistics (flushes by reason, draw calls, vertex, bytes)
+// NOTE: Counters keep accumulating (and wrap around) until rlResetBatchStats() is called,
+// so per-frame values can be computed as the difference between two reads
+rlBatchStats rlGetBatchStats(void)
+{
+    rlBatchStats stats = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Stats;
+#endif
+
+    return stats;
+}
+
+// Reset render batch statistics
+void rlResetBatchStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlBatchStats stats = { 0 };
+    RLGL.Stats = stats;
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -4402,6 +4820,7 @@ void rlSetShader(unsigned int id, int *locs)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentShaderId != id)
     {
+        RLGL.State.flushReason = RL_FLUSH_STATE;
         rlDrawRenderBatch(RLGL.currentBatch);
         RLGL.State.currentShaderId = id;
         RLGL.State.currentShaderLocs = locs;
@@ -4468,6 +4887,15 @@ void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned
 #endif
 }
 
+// Wait for shader storage writes before they are used
+// NOTE: Needed between dependent dispatches, before drawing from an SSBO and before rlReadShaderBuffer()
+void rlComputeShaderBarrier(void)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+#endif
+}
+
 // Load shader storage buffer object (SSBO)
 unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint)
 {
@@ -4993,6 +5421,149 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Load render batch vertex data into the VBO bound to GL_ARRAY_BUFFER
+// NOTE: If persistent, buffer storage is immutable and the returned pointer stays mapped for the buffer
+// lifetime (write only, coherent), NULL is returned if not persistent or mapping failed
+static void *rlLoadBatchVertexData(int size, const void *data, bool persistent)
+{
+    void *mapped = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (persistent)
+    {
+        glBufferStorage(GL_ARRAY_BUFFER, size, data, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_DYNAMIC_STORAGE_BIT);
+        mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    }
+    else glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+#else
+    glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+#endif
+
+    return mapped;
+}
+
+// Compare sorted draws by layer, group and call order
+static int rlCompareSortedDraws(const void *a, const void *b)
+{
+    const rlSortedDraw *drawA = (const rlSortedDraw *)a;
+    const rlSortedDraw *drawB = (const rlSortedDraw *)b;
+
+    if (drawA->layer != drawB->layer) return (drawA->layer < drawB->layer)? -1 : 1;
+    if (drawA->group != drawB->group) return (drawA->group < drawB->group)? -1 : 1;
+    return (drawA->index < drawB->index)? -1 : ((drawA->index > drawB->index)? 1 : 0);
+}
+
+// Draw render batch draw calls grouped by layer, texture and mode (draw sorting)
+// NOTE: Expects the batch vertex buffers bound and GL_TEXTURE0 active, as rlDrawRenderBatch() does,
+// draws of a group are submitted with a single glMultiDrawArrays()/glMultiDrawElements() on OpenGL 3.3
+static void rlDrawRenderBatchSorted(rlRenderBatch *batch)
+{
+    rlSortedDraw *draws = (rlSortedDraw *)RL_MALLOC(batch->drawCounter*sizeof(rlSortedDraw));
+    int *groups = (int *)RL_MALLOC(batch->drawCounter*sizeof(int));
+    int drawCount = 0;
+    int groupCount = 0;
+
+    // Find every draw group: first draw in a layer with a given texture and mode
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        if (batch->draws[i].vertexCount > 0)
+        {
+            int group = -1;
+
+            for (int g = 0; g < groupCount; g++)
+            {
+                rlDrawCall *first = &batch->draws[groups[g]];
+                if ((first->layer == batch->draws[i].layer) && (first->textureId == batch->draws[i].textureId) && (first->mode == batch->draws[i].mode)) { group = groups[g]; break; }
+            }
+
+            if (group == -1)
+            {
+                group = i;
+                groups[groupCount] = i;
+                groupCount++;
+            }
+
+            draws[drawCount].layer = batch->draws[i].layer;
+            draws[drawCount].group = group;
+            draws[drawCount].index = i;
+            draws[drawCount].vertexOffset = vertexOffset;
+            drawCount++;
+        }
+
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+    }
+
+    qsort(draws, drawCount, sizeof(rlSortedDraw), rlCompareSortedDraws);
+
+    // Submit every group, merging draws that are contiguous in the vertex buffer
+    int *firsts = (int *)RL_MALLOC(drawCount*sizeof(int));
+    int *counts = (int *)RL_MALLOC(drawCount*sizeof(int));
+    const void **indices = (const void **)RL_MALLOC(drawCount*sizeof(void *));
+
+    for (int i = 0; i < drawCount; )
+    {
+        int group = draws[i].group;     // NOTE: Group is a draw index, so it is unique across layers
+        int mode = batch->draws[group].mode;
+        int rangeCount = 0;
+
+        glBindTexture(GL_TEXTURE_2D, batch->draws[group].textureId);
+
+        for (; (i < drawCount) && (draws[i].group == group); i++)
+        {
+            rlDrawCall *draw = &batch->draws[draws[i].index];
+
+            if ((rangeCount > 0) && (firsts[rangeCount - 1] + counts[rangeCount - 1] == draws[i].vertexOffset)) counts[rangeCount - 1] += draw->vertexCount;
+            else
+            {
+                firsts[rangeCount] = draws[i].vertexOffset;
+                counts[rangeCount] = draw->vertexCount;
+                rangeCount++;
+            }
+        }
+
+        if ((mode == RL_LINES) || (mode == RL_TRIANGLES))
+        {
+#if defined(GRAPHICS_API_OPENGL_33)
+            glMultiDrawArrays(mode, firsts, counts, rangeCount);
+            RLGL.Stats.drawCallCount++;
+#else
+            for (int r = 0; r < rangeCount; r++) glDrawArrays(mode, firsts[r], counts[r]);
+            RLGL.Stats.drawCallCount += rangeCount;
+#endif
+        }
+        else
+        {
+            // Quads are drawn indexed, every 4 vertex take 6 indices
+            for (int r = 0; r < rangeCount; r++)
+            {
+#if defined(GRAPHICS_API_OPENGL_33)
+                indices[r] = (const void *)(firsts[r]/4*6*sizeof(GLuint));
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+                indices[r] = (const void *)(firsts[r]/4*6*sizeof(GLushort));
+#endif
+                counts[r] = counts[r]/4*6;
+                RLGL.Stats.indexCount += counts[r];
+            }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+            glMultiDrawElements(GL_TRIANGLES, counts, GL_UNSIGNED_INT, indices, rangeCount);
+            RLGL.Stats.drawCallCount++;
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            for (int r = 0; r < rangeCount; r++) glDrawElements(GL_TRIANGLES, counts[r], GL_UNSIGNED_SHORT, indices[r]);
+            RLGL.Stats.drawCallCount += rangeCount;
+#endif
+        }
+    }
+
+    RL_FREE(indices);
+    RL_FREE(counts);
+    RL_FREE(firsts);
+    RL_FREE(groups);
+    RL_FREE(draws);
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
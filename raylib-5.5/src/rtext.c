@@ -77,7 +77,7 @@
         #pragma GCC diagnostic ignored "-Wunused-function"
     #endif
 
-    #define STB_RECT_PACK_IMPLEMENTATION
+    // NOTE: stb_rect_pack implementation is included by rtextures module
     #include "external/stb_rect_pack.h"     // Required for: ttf/bdf font rectangles packaging
 
     #include <math.h>   // Required for: ttf/bdf font rectangles packaging
@@ -1125,6 +1125,50 @@ void DrawFPS(int posX, int posY)
     DrawText(TextFormat("%2i FPS", fps), posX, posY, 20, color);
 }
 
+// Draw frame stats breakdown, averaged over the last frames
+// NOTE: Uses default font, requires SUPPORT_FRAME_STATS to show data
+void DrawFrameStats(int posX, int posY)
+{
+    #define FRAME_STATS_AVERAGE_FRAMES      30      // Number of frames averaged
+
+    int count = GetFrameStatsCount();
+    if (count > FRAME_STATS_AVERAGE_FRAMES) count = FRAME_STATS_AVERAGE_FRAMES;
+
+    FrameStats average = { 0 };
+    unsigned int drawCalls = 0, vertexCount = 0, flushCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        FrameStats stats = GetFrameStats(i);
+        average.updateTime += stats.updateTime;
+        average.drawTime += stats.drawTime;
+        average.swapTime += stats.swapTime;
+        average.waitTime += stats.waitTime;
+        average.pollTime += stats.pollTime;
+        average.frameTime += stats.frameTime;
+        drawCalls += stats.drawCalls;
+        vertexCount += stats.vertexCount;
+        flushCount += stats.flushCount;
+    }
+
+    // Times shown in milliseconds
+    float scale = (count > 0)? 1000.0f/(float)count : 0.0f;
+    if (count > 0)
+    {
+        average.drawCalls = drawCalls/count;
+        average.vertexCount = vertexCount/count;
+        average.flushCount = flushCount/count;
+    }
+
+    DrawText(TextFormat("frame  %6.2f ms", average.frameTime*scale), posX, posY, 10, LIME);
+    DrawText(TextFormat("update %6.2f ms", average.updateTime*scale), posX, posY + 12, 10, LIME);
+    DrawText(TextFormat("draw   %6.2f ms", average.drawTime*scale), posX, posY + 24, 10, LIME);
+    DrawText(TextFormat("swap   %6.2f ms", average.swapTime*scale), posX, posY + 36, 10, LIME);
+    DrawText(TextFormat("wait   %6.2f ms", average.waitTime*scale), posX, posY + 48, 10, LIME);
+    DrawText(TextFormat("poll   %6.2f ms", average.pollTime*scale), posX, posY + 60, 10, LIME);
+    DrawText(TextFormat("%u draw calls, %u vertex, %u flushes", average.drawCalls, average.vertexCount, average.flushCount), posX, posY + 72, 10, LIME);
+}
+
 // Draw text (using default font)
 // NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
 // NOTE: chars spacing is proportional to fontSize
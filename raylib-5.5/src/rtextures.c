@@ -34,10 +34,17 @@
 *       #define SUPPORT_IMAGE_GENERATION
 *           Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*       #define SUPPORT_IMAGE_THREADS
+*           Split heavy image processing (blur, convolution...) across CPU threads (pthreads or Win32 threads)
+*
+*       #define RL_TEXTURES_NO_SIMD
+*           Use plain C loops instead of the SSE2 kernels for 8-bit per channel pixel operations
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
 *       stb_image_resize - Multiple image resize algorithms
+*       stb_rect_pack    - Rectangles packing, used for atlases (and font atlases in rtext module)
 *
 *
 *   LICENSE: zlib/libpng
@@ -78,6 +85,48 @@
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 
+// SIMD kernels for 8-bit per channel pixel data, plain C loops are used without them
+// NOTE: Define RL_TEXTURES_NO_SIMD to always use the plain C loops
+#if !defined(RL_TEXTURES_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RL_TEXTURES_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in ImageColor*()]
+    #endif
+#endif
+
+// Threads for image processing functions, work runs on the calling thread only without them
+#if defined(SUPPORT_IMAGE_THREADS)
+    #if defined(_WIN32)
+        #include <process.h>        // Required for: _beginthreadex()
+        #include <stdint.h>         // Required for: uintptr_t
+        // NOTE: Declaring functions required from windows.h to avoid including it
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short GroupNumber);
+        #define RL_TEXTURES_THREADS
+        #define RL_TEXTURES_THREADS_WIN32
+    #elif (defined(__unix__) || defined(__APPLE__)) && (!defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__))
+        #include <pthread.h>        // Required for: pthread_create(), pthread_join()
+        #include <unistd.h>         // Required for: sysconf()
+        #define RL_TEXTURES_THREADS
+        #define RL_TEXTURES_THREADS_PTHREAD
+    #endif
+#endif
+
+// Atomic operations on long values shared with the texture loading queue workers, sequentially consistent
+#if defined(RL_TEXTURES_THREADS)
+    #if defined(_MSC_VER)
+        #include <intrin.h>         // Required for: _InterlockedOr(), _InterlockedExchange()
+        #define ATOMIC_LOAD(ptr)            _InterlockedOr((volatile long *)(ptr), 0)
+        #define ATOMIC_STORE(ptr, value)    (void)_InterlockedExchange((volatile long *)(ptr), (value))
+        #define ATOMIC_EXCHANGE(ptr, value) _InterlockedExchange((volatile long *)(ptr), (value))
+    #else
+        #define ATOMIC_LOAD(ptr)            __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+        #define ATOMIC_STORE(ptr, value)    __atomic_store_n((ptr), (value), __ATOMIC_SEQ_CST)
+        #define ATOMIC_EXCHANGE(ptr, value) __atomic_exchange_n((ptr), (value), __ATOMIC_SEQ_CST)
+    #endif
+#endif
+
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -210,6 +259,18 @@
     #include "external/stb_perlin.h"        // Required for: stb_perlin_fbm_noise3
 #endif
 
+#if defined(__GNUC__) // GCC and Clang
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "external/stb_rect_pack.h"         // Required for: stbrp_init_target(), stbrp_pack_rects() [Used in atlases]
+
+#if defined(__GNUC__) // GCC and Clang
+    #pragma GCC diagnostic pop
+#endif
+
 #define STBIR_MALLOC(size,c) ((void)(c), RL_MALLOC(size))
 #define STBIR_FREE(ptr,c) ((void)(c), RL_FREE(ptr))
 
@@ -236,15 +297,201 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef MAX_IMAGE_THREADS
+    #define MAX_IMAGE_THREADS        16    // Maximum number of threads image processing functions split work across
+#endif
+
+#ifndef IMAGE_PIPELINE_BLOCK_SIZE
+    #define IMAGE_PIPELINE_BLOCK_SIZE  1024    // Pixels every image pipeline step processes before the next step runs (fits L1 cache)
+#endif
+
+#ifndef IMAGE_MIPMAP_STRIPE_ROWS
+    #define IMAGE_MIPMAP_STRIPE_ROWS     64    // Source rows of a mipmap stripe, taken down through log2(rows) levels at once (power of two)
+#endif
+
+#ifndef TEXTURE_QUEUE_RING_SIZE
+    #define TEXTURE_QUEUE_RING_SIZE     8    // Maximum number of images one texture loading queue worker holds at once (power of two)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image processing task: processes items (rows, columns, pixels...) [start, end) of a job split across threads
+typedef void (*ImageTaskCallback)(void *data, int start, int end);
+
+// Image filter job, shared by all the threads working on it
+typedef struct ImageFilterJob {
+    const Color *src;           // Source pixels
+    Color *dst;                 // Destination pixels, same size as source
+    int width;                  // Image width
+    int height;                 // Image height
+    int radius;                 // Box blur: window radius
+    const float *scales;        // Box blur: 1/(pixels in the window) at every x (rows) or y (columns)
+    int kernelWidth;            // Convolution: kernel width (and height)
+    const float *rowWeights;    // Separable convolution: horizontal pass weights
+    const float *columnWeights; // Separable convolution: vertical pass weights
+    const int *fixedWeights;    // Convolution: kernelWidth*kernelWidth weights, fixed point
+    int fixedShift;             // Convolution: fractional bits of fixedWeights
+} ImageFilterJob;
+
+// Image pipeline step, point operations compiled to run on RGBA pixels
+// NOTE: Consecutive tint, invert, contrast and brightness operations are folded into a single lookup tables step
+typedef struct ImagePipelineStep {
+    int type;                       // Operation type (ImageOperationType)
+    Color color;                    // Replace: color to replace
+    Color replace;                  // Replace: new color
+    unsigned char tables[4][256];   // Color operations: new value for every channel value (r, g, b, a)
+} ImagePipelineStep;
+
+// Image pipeline pass job: source pixels resized (or not) to destination RGBA pixels, with steps applied on the way
+typedef struct ImagePipelineJob {
+    const unsigned char *src;       // Source pixel data
+    int srcFormat;                  // Source pixel format, any uncompressed format
+    int srcWidth;                   // Source width
+    int srcHeight;                  // Source height
+    int srcBytesPerPixel;           // Source bytes per pixel
+    unsigned char *dst;             // Destination pixels (RGBA), can be the same as source if not resizing
+    int dstWidth;                   // Destination width
+    int dstHeight;                  // Destination height
+    const ImagePipelineStep *inputSteps;    // Steps applied to source pixels (before resizing)
+    int inputStepCount;                     // Number of input steps
+    const ImagePipelineStep *outputSteps;   // Steps applied to destination pixels
+    int outputStepCount;                    // Number of output steps
+    STBIR_RESIZE *resize;           // Bicubic resize: stb resizer, run in splits across threads
+} ImagePipelineJob;
+
+// Image transform job: pixels moved around (flip, rotation, resize) without changing their values
+typedef struct ImageTransformJob {
+    unsigned char *src;             // Source pixel data, flips modify it in place
+    unsigned char *dst;             // Destination pixel data (rotations and resize)
+    int width;                      // Source width
+    int height;                     // Source height
+    int bytesPerPixel;              // Bytes per pixel, any uncompressed format
+    bool clockwise;                 // Rotation: clockwise or counter-clockwise
+    int dstWidth;                   // Resize: destination width
+    const int *offsets;             // Resize: source row offset (in bytes) of every destination column
+    int yRatio;                     // Resize: source rows per destination row, 16.16 fixed point
+} ImageTransformJob;
+
+// Image mipmap job: a chain of levels with 8-bit channels, every level a 2x2 box filter of the previous one
+// NOTE: Levels [first, last] are generated in stripes, every stripe only needs rows of the previous levels it generated itself
+typedef struct ImageMipmapJob {
+    unsigned char *levels[32];      // Levels pixel data, level 0 is the base image (enough levels for any int size)
+    int widths[32];                 // Levels width
+    int heights[32];                // Levels height
+    int first;                      // First level generated by the stripes
+    int last;                       // Last level generated by the stripes
+    int channels;                   // Bytes per pixel, 1 to 4
+    int alphaChannel;               // sRGB: channel averaged as it is, -1 if none
+    const unsigned short *toLinear; // sRGB: 8-bit value to linear value (14 bit), NULL for a plain average
+    const unsigned char *fromLinear; // sRGB: sum of four linear values to the nearest 8-bit value of their average
+} ImageMipmapJob;
+
+// Pixel format converter: count pixels from src to dst, see GetPixelFormatJob()
+typedef void (*PixelFormatConverter)(const void *src, void *dst, int count);
+
+// Pixel format conversion job: direct converters through RGBA pixels, no normalized float pixels
+typedef struct PixelFormatJob {
+    const unsigned char *src;       // Source pixel data
+    int srcBytesPerPixel;           // Source bytes per pixel
+    unsigned char *dst;             // Destination pixel data
+    int dstBytesPerPixel;           // Destination bytes per pixel
+    PixelFormatConverter toColors;  // Source format to RGBA, NULL if source is RGBA
+    PixelFormatConverter fromColors; // RGBA to destination format, NULL if destination is RGBA
+} PixelFormatJob;
+
+// Color hash table, open addressing on packed 32-bit colors
+// NOTE: Key 0 (fully transparent black) marks empty slots, transparent pixels are never added to palettes
+typedef struct ColorTable {
+    unsigned int *keys;             // Packed colors
+    int *indices;                   // Palette index of every slot
+    int size;                       // Number of slots (power of two, at least twice the palette size)
+    int shift;                      // Hash shift: 32 - log2(size)
+} ColorTable;
+
+// Image palette band: colors of a band of pixels, in the order they first appear
+typedef struct ImagePaletteBand {
+    ColorTable table;               // Band colors hash table
+    Color *colors;                  // Band colors
+    int *counts;                    // Pixels of every band color (or of every palette color when counting again)
+    int colorCount;                 // Number of band colors
+    bool full;                      // Palette size reached, band stopped there
+} ImagePaletteBand;
+
+// Image palette job, pixels split in bands
+typedef struct ImagePaletteJob {
+    const unsigned char *data;      // Image pixel data
+    int format;                     // Image pixel format, any uncompressed format
+    int bytesPerPixel;              // Image bytes per pixel
+    int pixelCount;                 // Number of pixels
+    int maxPaletteSize;             // Maximum number of colors
+    int bandCount;                  // Number of bands
+    ImagePaletteBand bands[MAX_IMAGE_THREADS]; // Bands, in pixels order
+    const ColorTable *palette;      // Counting again: final palette colors
+} ImagePaletteJob;
+
+// Texture loading queue job: one texture waiting for its image to be decoded and uploaded
+typedef struct TextureQueueJob {
+    unsigned int id;                // Placeholder texture id (OpenGL)
+    int width;                      // Placeholder texture width
+    int height;                     // Placeholder texture height
+    int format;                     // Placeholder texture pixel format
+    char fileType[16];              // File extension, including point: ".png"
+    unsigned char *fileData;        // File data, unloaded once decoded
+    int dataSize;                   // File data size
+    bool mapped;                    // File data is a memory mapped file (LoadFileMapped())
+    Image image;                    // Decoded image, set by the worker
+    bool decoding;                  // Sent to a worker, waiting for its result (main thread only)
+    bool canceled;                  // Texture unloaded while decoding, result is discarded (main thread only)
+} TextureQueueJob;
+
+// Texture atlas page packer, skyline packing state kept between images
+// NOTE: Packers are allocated one by one, stb_rect_pack context points to itself
+typedef struct TextureAtlasPacker {
+    stbrp_context context;          // Packing context
+    stbrp_node *nodes;              // Packing nodes, one per page column
+} TextureAtlasPacker;
+
+#if defined(RL_TEXTURES_THREADS)
+// Texture loading queue ring, lock-free single producer single consumer queue of jobs
+typedef struct TextureQueueRing {
+    TextureQueueJob *jobs[TEXTURE_QUEUE_RING_SIZE];
+    long head;                      // Next job to pop, written by the consumer only
+    long tail;                      // Next free slot, written by the producer only
+} TextureQueueRing;
+
+// Texture loading queue worker: decodes the jobs of its requests ring into its results ring
+// NOTE: Workers exit once their requests ring is empty, the main thread starts them again on new jobs
+typedef struct TextureQueueWorker {
+    TextureQueueRing requests;      // Jobs to decode, main thread to worker
+    TextureQueueRing results;       // Decoded jobs, worker to main thread
+    long running;                   // Worker thread running flag, shared
+    int jobCount;                   // Jobs sent and not received back yet (main thread only)
+    bool started;                   // Thread handle needs to be joined (main thread only)
+#if defined(RL_TEXTURES_THREADS_WIN32)
+    uintptr_t handle;
+#else
+    pthread_t handle;
+#endif
+} TextureQueueWorker;
+#endif
+
+// Texture loading queue, state owned by the main thread
+typedef struct TextureQueue {
+    TextureQueueJob **jobs;         // Queued jobs, in queuing order
+    int jobCount;                   // Number of queued jobs, canceled ones included
+    int jobCapacity;                // Size of the jobs array
+#if defined(RL_TEXTURES_THREADS)
+    TextureQueueWorker workers[MAX_IMAGE_THREADS]; // Decoding workers
+    int workerCount;                // Number of workers, set on first use
+    long stop;                      // Workers stop decoding, set on unload (shared)
+#endif
+} TextureQueue;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static TextureQueue textureQueue = { 0 };   // Texture loading queue, see LoadTextureAsync()
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -254,9 +501,71 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+extern void UnloadTextureQueue(void);       // Unload texture loading queue, called by CloseWindow()
+
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void ConvertPixelsToColors(const void *data, int format, int count, Color *pixels); // Convert pixel data in an uncompressed format to a Color array
+static bool GetPixelFormatJob(int srcFormat, int dstFormat, PixelFormatJob *job); // Get direct converters between two pixel formats, false if there are none
+static void ConvertPixelFormatPixels(void *data, int start, int end);   // Pixel format conversion task: pixels [start, end)
+static void ConvertGrayToColors(const void *src, void *dst, int count);         // Direct converter: GRAYSCALE to RGBA
+static void ConvertGrayAlphaToColors(const void *src, void *dst, int count);    // Direct converter: GRAY_ALPHA to RGBA
+static void ConvertR5G6B5ToColors(const void *src, void *dst, int count);       // Direct converter: R5G6B5 to RGBA
+static void ConvertR8G8B8ToColors(const void *src, void *dst, int count);       // Direct converter: R8G8B8 to RGBA
+static void ConvertR5G5B5A1ToColors(const void *src, void *dst, int count);     // Direct converter: R5G5B5A1 to RGBA
+static void ConvertR4G4B4A4ToColors(const void *src, void *dst, int count);     // Direct converter: R4G4B4A4 to RGBA
+static void ConvertColorsToGray(const void *src, void *dst, int count);         // Direct converter: RGBA to GRAYSCALE, can run in place
+static void ConvertColorsToGrayAlpha(const void *src, void *dst, int count);    // Direct converter: RGBA to GRAY_ALPHA
+static void ConvertColorsToR5G6B5(const void *src, void *dst, int count);       // Direct converter: RGBA to R5G6B5
+static void ConvertColorsToR8G8B8(const void *src, void *dst, int count);       // Direct converter: RGBA to R8G8B8
+static void ConvertColorsToR5G5B5A1(const void *src, void *dst, int count);     // Direct converter: RGBA to R5G5B5A1
+static void ConvertColorsToR4G4B4A4(const void *src, void *dst, int count);     // Direct converter: RGBA to R4G4B4A4
+static int GetImageThreadCount(void);                       // Get number of threads image processing functions split work across
+static void ImageParallelFor(int count, int minBand, ImageTaskCallback task, void *data); // Run task over items [0, count) split in bands across threads
+static void ImageResizeRowsNN(void *data, int start, int end);         // Nearest-Neighbor resize task: destination rows [start, end)
+static void ImageFlipRows(void *data, int start, int end);              // Vertical flip task: swap rows y and height - 1 - y for y in [start, end)
+static void ImageMirrorRows(void *data, int start, int end);            // Horizontal flip task: reverse rows [start, end) in place
+static void ImageRotateRows(void *data, int start, int end);            // 90deg rotation task: destination rows [start, end), in tiles
+static void LoadColorTable(ColorTable *table, int maxColors);           // Load an empty color hash table with room for maxColors
+static void UnloadColorTable(ColorTable *table);                        // Unload color hash table
+static int GetColorTableSlot(const ColorTable *table, unsigned int key); // Get slot holding key, or the empty slot where it goes
+static void ImagePaletteBands(void *data, int start, int end);          // Palette task: colors of bands [start, end)
+static void ImagePaletteCountBands(void *data, int start, int end);     // Palette task: count pixels of the palette colors in bands [start, end)
+static bool GetImageInfoFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *width, int *height, int *format); // Get size and format of an image file data without decoding it
+static void UploadTextureQueueJob(TextureQueueJob *job);                // Upload decoded image of a job to its texture and remove job from the queue
+static void CancelTextureQueueJob(unsigned int id);                     // Cancel job queued for a texture, if any
+static void CopyAtlasPixels(Color *page, int pageWidth, const Color *pixels, int width, int height, int x, int y, int padding); // Copy pixels into an atlas page with a gutter repeating the edge pixels
+#if defined(RL_TEXTURES_THREADS)
+static bool PushTextureQueueJob(TextureQueueRing *ring, TextureQueueJob *job); // Push job into a ring, producer side
+static bool PopTextureQueueJob(TextureQueueRing *ring, TextureQueueJob **job); // Pop job from a ring, consumer side
+static void SendTextureQueueJobs(void);                                 // Send jobs waiting in the queue to workers with room for them
+#endif
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static int GetImagePixelCount(Image image);                 // Get number of pixels in image data, all mipmap levels included
+static void ImageApplyColorTables(Image *image, unsigned char tables[4][256]); // Replace every color channel value through a lookup table
+static void ImageSetColors(Image *image, Color *pixels);     // Replace image data by a RGBA pixels array, converted back to the image format
+static void ImagePremultiplyPixels(void *data, int start, int end);     // Premultiply alpha task
+static void ImageUnpremultiplyPixels(void *data, int start, int end);   // Reverse premultiplied alpha task
+static void ImageBlurBoxRows(void *data, int start, int end);           // Box blur task, horizontal pass
+static void ImageBlurBoxColumns(void *data, int start, int end);        // Box blur task, vertical pass
+static bool IsKernelSeparable(const float *kernel, int kernelWidth, float *columnWeights, float *rowWeights); // Check if a square kernel can be applied in two 1D passes
+static void ImageConvolveSeparableRows(void *data, int start, int end); // Separable convolution task
+static void ImageConvolveRows(void *data, int start, int end);          // Convolution task
+static void GetColorOperationTables(ImageOperation operation, unsigned char tables[4][256]); // Get lookup tables for a tint, invert, contrast or brightness operation
+static void AddImagePipelineOperation(ImagePipeline *pipeline, ImageOperation operation);     // Record an operation at the end of an image pipeline
+static int CompileImagePipelineSteps(const ImageOperation *operations, int count, bool alpha, ImagePipelineStep *steps); // Compile point operations into steps, returns steps count
+static void ApplyImagePipelineSteps(const ImagePipelineStep *steps, int stepCount, unsigned char *pixels, int count); // Apply steps to RGBA pixels
+static void ApplyImagePipelineOperations(Image *image, const ImageOperation *operations, int count); // Apply operations one by one with the Image*() functions
+static void ImagePipelineRows(void *data, int start, int end);          // Image pipeline task, no resize
+static void ImagePipelineRowsNN(void *data, int start, int end);        // Image pipeline task, Nearest-Neighbor resize
+static void ImagePipelineResizeSplits(void *data, int start, int end);  // Image pipeline task, bicubic resize splits
+static const void *ImagePipelineInputCallback(void *optionalOutput, const void *inputPtr, int count, int x, int y, void *context); // Bicubic resize source scanline callback
+static void ImagePipelineOutputCallback(const void *outputPtr, int count, int y, void *context); // Bicubic resize destination scanline callback
+static void GenImageMipmapLevels(unsigned char *data, int width, int height, int channels, int first, int count, bool srgb); // Generate levels [first, count) of a mip chain with 8-bit channels
+static void ImageMipmapStripes(void *data, int start, int end);         // Mipmap task, stripes [start, end) down through the job levels
+static void ImageMipmapRow(const ImageMipmapJob *job, int level, int y); // Mipmap row, 2x2 box filter of the previous level
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -280,16 +589,20 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
+    // Loading file to memory, mapped if possible: decoders read it without a copy
     int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = LoadFileMapped(fileName, &dataSize);
+    bool mapped = (fileData != NULL);
+
+    if (!mapped) fileData = LoadFileData(fileName, &dataSize);
 
     // Loading image from memory data
     if (fileData != NULL)
     {
         image = LoadImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
 
-        UnloadFileData(fileData);
+        if (mapped) UnloadFileMapped(fileData, dataSize);
+        else UnloadFileData(fileData);
     }
 
     return image;
@@ -300,8 +613,12 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 {
     Image image = { 0 };
 
+    // NOTE: Mapping the file, image data is copied once from it
     int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = LoadFileMapped(fileName, &dataSize);
+    bool mapped = (fileData != NULL);
+
+    if (!mapped) fileData = LoadFileData(fileName, &dataSize);
 
     if (fileData != NULL)
     {
@@ -321,7 +638,8 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
             image.format = format;
         }
 
-        UnloadFileData(fileData);
+        if (mapped) UnloadFileMapped(fileData, dataSize);
+        else UnloadFileData(fileData);
     }
 
     return image;
@@ -793,6 +1111,125 @@ bool ExportImageAsCode(Image image, const char *fileName)
     return success;
 }
 
+// Load atlas pages packing images, every page width x height (R8G8B8A8), regions of every image returned
+// NOTE: Images get a gutter of padding pixels repeating their edge pixels, so filtering and the first
+// mipmap levels do not blend in their neighbours, images not fitting a page get region page -1
+// NOTE: If a page can not be allocated, the pages done so far are returned and the images left get region page -1
+Image *LoadImageAtlas(const Image *images, int imageCount, int width, int height, int padding, AtlasRegion *regions, int *pageCount)
+{
+    Image *pages = NULL;
+
+    if ((regions == NULL) || (pageCount == NULL))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Atlas regions and page count are required");
+        return pages;
+    }
+
+    *pageCount = 0;
+
+    if ((images == NULL) || (imageCount <= 0) || (width <= 0) || (height <= 0) || (padding < 0)) return pages;
+
+    stbrp_rect *rects = (stbrp_rect *)RL_CALLOC(imageCount, sizeof(stbrp_rect));
+    stbrp_node *nodes = (stbrp_node *)RL_MALLOC(width*sizeof(stbrp_node));
+    stbrp_context context = { 0 };
+
+    if ((rects == NULL) || (nodes == NULL))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Atlas required memory could not be allocated");
+        RL_FREE(nodes);
+        RL_FREE(rects);
+        return pages;
+    }
+
+    int remaining = 0;
+
+    for (int i = 0; i < imageCount; i++)
+    {
+        regions[i].page = -1;
+        regions[i].rec = (Rectangle){ 0 };
+
+        rects[i].id = i;
+        rects[i].w = images[i].width + 2*padding;
+        rects[i].h = images[i].height + 2*padding;
+
+        if ((images[i].data == NULL) || (images[i].width <= 0) || (images[i].height <= 0)) rects[i].was_packed = 1;    // Nothing to pack
+        else if (images[i].format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Atlas image %i pixel format is compressed, it can not be packed", i);
+            rects[i].was_packed = 1;
+        }
+        else if ((rects[i].w > width) || (rects[i].h > height))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Atlas image %i bigger than atlas page (%i x %i)", i, width, height);
+            rects[i].was_packed = 1;
+        }
+        else remaining++;
+    }
+
+    // Every page takes all the images it can fit from the ones left
+    while (remaining > 0)
+    {
+        int count = 0;
+        for (int i = 0; i < imageCount; i++) if (!rects[i].was_packed) rects[count++] = rects[i];
+
+        stbrp_init_target(&context, width, height, nodes, width);
+        stbrp_pack_rects(&context, rects, count);
+
+        void *data = RL_CALLOC(width*height, sizeof(Color));
+        Image *temp = (data != NULL)? (Image *)RL_REALLOC(pages, (*pageCount + 1)*sizeof(Image)) : NULL;
+
+        if (temp == NULL)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Atlas page %i memory could not be allocated, %i images not packed", *pageCount, remaining);
+            RL_FREE(data);
+            break;
+        }
+
+        pages = temp;
+        Image *page = &pages[*pageCount];
+        page->data = data;
+        page->width = width;
+        page->height = height;
+        page->mipmaps = 1;
+        page->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        for (int i = 0; i < count; i++)
+        {
+            if (!rects[i].was_packed) continue;
+
+            const Image *image = &images[rects[i].id];
+            Color *pixels = LoadImageColors(*image);
+
+            CopyAtlasPixels((Color *)page->data, width, pixels, image->width, image->height, rects[i].x, rects[i].y, padding);
+            UnloadImageColors(pixels);
+
+            regions[rects[i].id].page = *pageCount;
+            regions[rects[i].id].rec = (Rectangle){ (float)(rects[i].x + padding), (float)(rects[i].y + padding), (float)image->width, (float)image->height };
+            remaining--;
+        }
+
+        (*pageCount)++;
+
+        // Restore unpacked rectangles order (stb_rect_pack keeps it), packed ones are skipped next page
+        for (int i = count; i < imageCount; i++) rects[i].was_packed = 1;
+    }
+
+    RL_FREE(nodes);
+    RL_FREE(rects);
+
+    return pages;
+}
+
+// Unload atlas pages loaded with LoadImageAtlas()
+void UnloadImageAtlas(Image *pages, int pageCount)
+{
+    if (pages == NULL) return;
+
+    for (int i = 0; i < pageCount; i++) UnloadImage(pages[i]);
+
+    RL_FREE(pages);
+}
+
 //------------------------------------------------------------------------------------
 // Image generation functions
 //------------------------------------------------------------------------------------
@@ -1260,189 +1697,205 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+            // Common pairs of 8-bit and 16-bit formats have direct converters, others go through normalized float pixels
+            PixelFormatJob job = { 0 };
 
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
+            if (GetPixelFormatJob(image->format, newFormat, &job))
+            {
+                job.src = (const unsigned char *)image->data;
+                job.dst = (unsigned char *)RL_MALLOC(GetPixelDataSize(image->width, image->height, newFormat));
+                ImageParallelFor(image->width*image->height, 16384, ConvertPixelFormatPixels, &job);
 
-            switch (image->format)
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = job.dst;
+                image->format = newFormat;
+            }
+            else
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+                Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = NULL;
+                image->format = newFormat;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                switch (image->format)
                 {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
+                    case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                        }
+
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                    {
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
+                        for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*63.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+                        }
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                    {
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*31.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
+                            a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
                     {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*15.0f));
+                            g = (unsigned char)(round(pixels[i].y*15.0f));
+                            b = (unsigned char)(round(pixels[i].z*15.0f));
+                            a = (unsigned char)(round(pixels[i].w*15.0f));
+
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                        }
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                            ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32:
+                    {
+                        // WARNING: Image is converted to GRAYSCALE equivalent 32bit
 
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
                     {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
                     {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                            ((float *)image->data)[i + 3] = pixels[k].w;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16:
                     {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 16bit
+                        // WARNING: Image is converted to GRAYSCALE equivalent 16bit
 
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
                     {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                            ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                            ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
                     {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
-            }
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                            ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                            ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                            ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
+                        }
+                    } break;
+                    default: break;
+                }
 
-            RL_FREE(pixels);
-            pixels = NULL;
+                RL_FREE(pixels);
+                pixels = NULL;
+            }
 
             // In case original image had mipmaps, generate mipmaps for formatted image
             // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
@@ -1708,42 +2161,47 @@ Image ImageFromChannel(Image image, int selectedChannel)
 }
 
 // Resize and image to new size using Nearest-Neighbor scaling algorithm
+// NOTE: Pixels are copied in the image format, rows split in bands across threads
 void ImageResizeNN(Image *image,int newWidth,int newHeight)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+        return;
+    }
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+    int *offsets = (int *)RL_MALLOC(newWidth*sizeof(int));
 
     // EDIT: added +1 to account for an early rounding problem
     int xRatio = (int)((image->width << 16)/newWidth) + 1;
     int yRatio = (int)((image->height << 16)/newHeight) + 1;
 
-    int x2, y2;
-    for (int y = 0; y < newHeight; y++)
-    {
-        for (int x = 0; x < newWidth; x++)
-        {
-            x2 = ((x*xRatio) >> 16);
-            y2 = ((y*yRatio) >> 16);
+    // Source column of every destination column, the same for all rows
+    for (int x = 0; x < newWidth; x++) offsets[x] = ((x*xRatio) >> 16)*bytesPerPixel;
 
-            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
-        }
-    }
+    ImageTransformJob job = { 0 };
+    job.src = (unsigned char *)image->data;
+    job.dst = output;
+    job.width = image->width;
+    job.height = image->height;
+    job.bytesPerPixel = bytesPerPixel;
+    job.dstWidth = newWidth;
+    job.offsets = offsets;
+    job.yRatio = yRatio;
 
-    int format = image->format;
+    ImageParallelFor(newHeight, 16, ImageResizeRowsNN, &job);
 
+    RL_FREE(offsets);
     RL_FREE(image->data);
 
     image->data = output;
     image->width = newWidth;
     image->height = newHeight;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
-
-    UnloadImageColors(pixels);
 }
 
 // Resize and image to new size
@@ -2089,152 +2547,65 @@ void ImageAlphaPremultiply(Image *image)
     ImageFormat(image, format);
 }
 
-// Apply box blur to image
+// Apply gaussian blur to image
+// NOTE: Approximated by GAUSSIAN_BLUR_ITERATIONS box blurs of radius blurSize on premultiplied alpha,
+// every pass is split in bands of rows (or columns) across threads
 void ImageBlurGaussian(Image *image, int blurSize)
 {
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (blurSize < 1)) return;
 
-    ImageAlphaPremultiply(image);
+    int width = image->width;
+    int height = image->height;
 
     Color *pixels = LoadImageColors(*image);
+    Color *pixelsCopy = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    // Box window is [x - blurSize, x + blurSize], cut at the image borders: 1/(pixels in it) for every x and y
+    float *rowScales = (float *)RL_MALLOC(width*sizeof(float));
+    float *columnScales = (float *)RL_MALLOC(height*sizeof(float));
 
-    for (int i = 0; i < (image->height*image->width); i++)
-    {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
+    for (int x = 0; x < width; x++) rowScales[x] = 1.0f/(float)(((x + blurSize < width)? x + blurSize : width - 1) - ((x - blurSize > 0)? x - blurSize : 0) + 1);
+    for (int y = 0; y < height; y++) columnScales[y] = 1.0f/(float)(((y + blurSize < height)? y + blurSize : height - 1) - ((y - blurSize > 0)? y - blurSize : 0) + 1);
+
+    ImageFilterJob job = { 0 };
+    job.width = width;
+    job.height = height;
+    job.radius = blurSize;
+
+    job.dst = pixels;
+    ImageParallelFor(width*height, 4096, ImagePremultiplyPixels, &job);
 
     // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
     for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
     {
         // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
-
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
+        job.src = pixels;
+        job.dst = pixelsCopy;
+        job.scales = rowScales;
+        ImageParallelFor(height, 8, ImageBlurBoxRows, &job);
 
         // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
-
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
-    }
-
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
-    {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
+        job.src = pixelsCopy;
+        job.dst = pixels;
+        job.scales = columnScales;
+        ImageParallelFor(width, 64, ImageBlurBoxColumns, &job);
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
+    job.dst = pixels;
+    ImageParallelFor(width*height, 4096, ImageUnpremultiplyPixels, &job);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    RL_FREE(pixelsCopy);
+    RL_FREE(rowScales);
+    RL_FREE(columnScales);
 
-    ImageFormat(image, format);
+    ImageSetColors(image, pixels);
 }
 
 // Apply custom square convolution kernel to image
-// NOTE: The convolution kernel matrix is expected to be square
+// NOTE: The convolution kernel matrix is expected to be square, pixels out of the image count as 0.
+// Kernels that are a column times a row (blur, sobel...) are applied in two 1D passes,
+// any other kernel in one pass with fixed point weights. Rows are split in bands across threads
 void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 {
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || kernel == NULL) return;
@@ -2248,119 +2619,61 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
     }
 
     Color *pixels = LoadImageColors(*image);
+    Color *result = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+    float *weights = (float *)RL_MALLOC(kernelWidth*2*sizeof(float));
 
-    Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = RL_MALLOC(kernelSize*sizeof(Vector4));
+    ImageFilterJob job = { 0 };
+    job.src = pixels;
+    job.dst = result;
+    job.width = image->width;
+    job.height = image->height;
+    job.kernelWidth = kernelWidth;
 
-    for (int i = 0; i < kernelSize; i++)
+    if ((kernelWidth >= 3) && IsKernelSeparable(kernel, kernelWidth, weights, weights + kernelWidth))
     {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
-
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
+        job.columnWeights = weights;
+        job.rowWeights = weights + kernelWidth;
 
-    int startRange = 0, endRange = 0;
-
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
+        ImageParallelFor(image->height, 32, ImageConvolveSeparableRows, &job);
     }
     else
     {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
-    }
+        // Fixed point weights with as many fractional bits (up to 14) as fit 16 bit weights and 32 bit sums
+        float maxWeight = 0.0f;
+        float totalWeight = 0.0f;
 
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
+        for (int i = 0; i < kernelSize; i++)
         {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
+            if (fabsf(kernel[i]) > maxWeight) maxWeight = fabsf(kernel[i]);
+            totalWeight += fabsf(kernel[i]);
+        }
 
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
+        int shift = 14;
+        while ((shift > 0) && ((maxWeight*(float)(1 << shift) > 32767.0f) || (totalWeight*255.0f*(float)(1 << shift) > 2147483647.0f))) shift--;
 
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
+        int *fixedWeights = (int *)RL_MALLOC(kernelSize*sizeof(int));
 
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
-
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
-
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
+        for (int i = 0; i < kernelSize; i++)
+        {
+            float weight = roundf(kernel[i]*(float)(1 << shift));
+            if (weight < -32768.0f) weight = -32768.0f;
+            if (weight > 32767.0f) weight = 32767.0f;
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
+            fixedWeights[i] = (int)weight;
         }
-    }
 
-    for (int i = 0; i < (image->width*image->height); i++)
-    {
-        float alpha = (float)imageCopy2[i].w;
+        job.fixedWeights = fixedWeights;
+        job.fixedShift = shift;
+
+        ImageParallelFor(image->height, 8, ImageConvolveRows, &job);
 
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
+        RL_FREE(fixedWeights);
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
+    RL_FREE(weights);
+    RL_FREE(pixels);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    ImageFormat(image, format);
+    ImageSetColors(image, result);
 }
 
 // Generate all mipmap levels for a provided image
@@ -2368,10 +2681,25 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 // NOTE 2: image.data is scaled to include mipmap levels
 // NOTE 3: Mipmaps format is the same as base image
 void ImageMipmaps(Image *image)
+{
+    ImageMipmapsEx(image, false);
+}
+
+// Generate all mipmap levels for a provided image, averaging color channels in linear light if srgb
+// NOTE 1: Every level is a 2x2 box filter of the previous one, odd sized levels leave their last row or column out
+// NOTE 2: Levels already in the image (image.mipmaps) are kept, the next ones are generated from the last of them
+// NOTE 3: Formats with 8-bit channels are filtered in place, other formats through an RGBA copy of the levels
+void ImageMipmapsEx(Image *image, bool srgb)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mipmaps can not be generated for compressed formats");
+        return;
+    }
+
     int mipCount = 1;                   // Required mipmap levels count (including base level)
     int mipWidth = image->width;        // Base image width
     int mipHeight = image->height;      // Base image height
@@ -2393,48 +2721,103 @@ void ImageMipmaps(Image *image)
         mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);       // Add mipmap size (in bytes)
     }
 
-    if (image->mipmaps < mipCount)
+    if (image->mipmaps >= mipCount)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
+        return;
+    }
+
+    // All levels in one allocation, the base level (and levels already there) stay where they are
+    void *temp = RL_REALLOC(image->data, mipSize);
+
+    if (temp == NULL)
     {
-        void *temp = RL_REALLOC(image->data, mipSize);
+        TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+        return;
+    }
 
-        if (temp != NULL) image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-        else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+    image->data = temp;
 
-        // Pointer to allocated memory point where store next mipmap level data
-        unsigned char *nextmip = image->data;
+    int first = (image->mipmaps > 1)? image->mipmaps : 1;      // First level to generate
+    int channels = 0;
+
+    switch (image->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+        default: break;
+    }
 
+    if (channels > 0) GenImageMipmapLevels((unsigned char *)image->data, image->width, image->height, channels, first, mipCount, srgb);
+    else
+    {
+        // Source level (the last one kept) and the levels after it, as RGBA
+        unsigned char *level = (unsigned char *)image->data;
         mipWidth = image->width;
         mipHeight = image->height;
-        mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
 
-        for (int i = 1; i < mipCount; i++)
+        for (int i = 0; i < first - 1; i++)
         {
-            nextmip += mipSize;
+            level += GetPixelDataSize(mipWidth, mipHeight, image->format);
+            if (mipWidth != 1) mipWidth /= 2;
+            if (mipHeight != 1) mipHeight /= 2;
+        }
 
-            mipWidth /= 2;
-            mipHeight /= 2;
+        int rgbaSize = 0;
 
-            // Security check for NPOT textures
-            if (mipWidth < 1) mipWidth = 1;
-            if (mipHeight < 1) mipHeight = 1;
+        for (int i = first - 1, width = mipWidth, height = mipHeight; i < mipCount; i++)
+        {
+            rgbaSize += width*height*4;
+            if (width != 1) width /= 2;
+            if (height != 1) height /= 2;
+        }
 
-            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+        unsigned char *rgba = (unsigned char *)RL_MALLOC(rgbaSize);
 
-            if (i < image->mipmaps) continue;
+        if (rgba == NULL)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
 
-            TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
+        ConvertPixelsToColors(level, image->format, mipWidth*mipHeight, (Color *)rgba);
+        GenImageMipmapLevels(rgba, mipWidth, mipHeight, 4, 1, mipCount - first + 1, srgb);
 
-            ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
+        // Back to the image format, level by level
+        PixelFormatJob formatJob = { 0 };
+        bool direct = GetPixelFormatJob(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, image->format, &formatJob);
+        unsigned char *rgbaLevel = rgba;
 
-            memcpy(nextmip, imCopy.data, mipSize);
-        }
+        for (int i = first; i < mipCount; i++)
+        {
+            level += GetPixelDataSize(mipWidth, mipHeight, image->format);
+            rgbaLevel += mipWidth*mipHeight*4;
+            if (mipWidth != 1) mipWidth /= 2;
+            if (mipHeight != 1) mipHeight /= 2;
+
+            if (direct)
+            {
+                formatJob.src = rgbaLevel;
+                formatJob.dst = level;
+                ImageParallelFor(mipWidth*mipHeight, 16384, ConvertPixelFormatPixels, &formatJob);
+            }
+            else
+            {
+                Image levelImage = { rgbaLevel, mipWidth, mipHeight, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+                Image converted = ImageCopy(levelImage);
+                ImageFormat(&converted, image->format);
 
-        UnloadImage(imCopy);
+                if (converted.data != NULL) memcpy(level, converted.data, GetPixelDataSize(mipWidth, mipHeight, image->format));
+                UnloadImage(converted);
+            }
+        }
 
-        image->mipmaps = mipCount;
+        RL_FREE(rgba);
     }
-    else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
+
+    image->mipmaps = mipCount;
 }
 
 // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
@@ -2550,6 +2933,7 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
 }
 
 // Flip image vertically
+// NOTE: Rows are swapped in place, split in bands across threads
 void ImageFlipVertical(Image *image)
 {
     // Security check to avoid program crash
@@ -2559,21 +2943,18 @@ void ImageFlipVertical(Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
-        {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
-        }
+        ImageTransformJob job = { 0 };
+        job.src = (unsigned char *)image->data;
+        job.width = image->width;
+        job.height = image->height;
+        job.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
 
-        RL_FREE(image->data);
-        image->data = flippedData;
+        ImageParallelFor(image->height/2, 16, ImageFlipRows, &job);
     }
 }
 
 // Flip image horizontally
+// NOTE: Rows are reversed in place, split in bands across threads
 void ImageFlipHorizontal(Image *image)
 {
     // Security check to avoid program crash
@@ -2583,38 +2964,13 @@ void ImageFlipHorizontal(Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                // OPTION 1: Move pixels with memcpy()
-                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
-
-                // OPTION 2: Just copy data pixel by pixel
-                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
-            }
-        }
-
-        RL_FREE(image->data);
-        image->data = flippedData;
+        ImageTransformJob job = { 0 };
+        job.src = (unsigned char *)image->data;
+        job.width = image->width;
+        job.height = image->height;
+        job.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
 
-        /*
-        // OPTION 3: Faster implementation (specific for 32bit pixels)
-        // NOTE: It does not require additional allocations
-        uint32_t *ptr = (uint32_t *)image->data;
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width/2; x++)
-            {
-                uint32_t backup = ptr[y*image->width + x];
-                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
-                ptr[y*image->width + (image->width - 1 - x)] = backup;
-            }
-        }
-        */
+        ImageParallelFor(image->height, 16, ImageMirrorRows, &job);
     }
 }
 
@@ -2678,6 +3034,7 @@ void ImageRotate(Image *image, int degrees)
 }
 
 // Rotate image clockwise 90deg
+// NOTE: Done in tiles that fit in cache, destination rows split in bands across threads
 void ImageRotateCW(Image *image)
 {
     // Security check to avoid program crash
@@ -2690,14 +3047,15 @@ void ImageRotateCW(Image *image)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
+        ImageTransformJob job = { 0 };
+        job.src = (unsigned char *)image->data;
+        job.dst = rotatedData;
+        job.width = image->width;
+        job.height = image->height;
+        job.bytesPerPixel = bytesPerPixel;
+        job.clockwise = true;
+
+        ImageParallelFor(image->width, 32, ImageRotateRows, &job);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -2710,6 +3068,7 @@ void ImageRotateCW(Image *image)
 }
 
 // Rotate image counter-clockwise 90deg
+// NOTE: Done in tiles that fit in cache, destination rows split in bands across threads
 void ImageRotateCCW(Image *image)
 {
     // Security check to avoid program crash
@@ -2722,14 +3081,15 @@ void ImageRotateCCW(Image *image)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
-            }
-        }
+        ImageTransformJob job = { 0 };
+        job.src = (unsigned char *)image->data;
+        job.dst = rotatedData;
+        job.width = image->width;
+        job.height = image->height;
+        job.bytesPerPixel = bytesPerPixel;
+        job.clockwise = false;
+
+        ImageParallelFor(image->width, 32, ImageRotateRows, &job);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -2742,118 +3102,150 @@ void ImageRotateCCW(Image *image)
 }
 
 // Modify image color: tint
+// NOTE: 8-bit per channel formats are modified in place (all mipmap levels), other formats are converted to RGBA and back
 void ImageColorTint(Image *image, Color color)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
+#if defined(RL_TEXTURES_SSE2)
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
     {
-        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
-        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
-        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
-        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+        unsigned char *data = (unsigned char *)image->data;
+        int count = GetImagePixelCount(*image);
+        int i = 0;
 
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
-    }
+        // Multiply 4 pixels at a time, 16bit per channel
+        // NOTE: (t + 1 + (t >> 8)) >> 8 is exactly t/255 for any t = channel*tint
+        __m128i zero = _mm_setzero_si128();
+        __m128i one = _mm_set1_epi16(1);
+        __m128i tint = _mm_setr_epi16(color.r, color.g, color.b, color.a, color.r, color.g, color.b, color.a);
 
-    int format = image->format;
-    RL_FREE(image->data);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i pixels = _mm_loadu_si128((__m128i *)(data + i*4));
+            __m128i low = _mm_mullo_epi16(_mm_unpacklo_epi8(pixels, zero), tint);
+            __m128i high = _mm_mullo_epi16(_mm_unpackhi_epi8(pixels, zero), tint);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            low = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(low, one), _mm_srli_epi16(low, 8)), 8);
+            high = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(high, one), _mm_srli_epi16(high, 8)), 8);
 
-    ImageFormat(image, format);
+            _mm_storeu_si128((__m128i *)(data + i*4), _mm_packus_epi16(low, high));
+        }
+
+        for (; i < count; i++)
+        {
+            data[i*4] = (unsigned char)(((int)data[i*4]*(int)color.r)/255);
+            data[i*4 + 1] = (unsigned char)(((int)data[i*4 + 1]*(int)color.g)/255);
+            data[i*4 + 2] = (unsigned char)(((int)data[i*4 + 2]*(int)color.b)/255);
+            data[i*4 + 3] = (unsigned char)(((int)data[i*4 + 3]*(int)color.a)/255);
+        }
+
+        return;
+    }
+#endif
+
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR_TINT;
+    operation.color = color;
+
+    unsigned char tables[4][256] = { 0 };
+    GetColorOperationTables(operation, tables);
+    ImageApplyColorTables(image, tables);
 }
 
 // Modify image color: invert
+// NOTE: 8-bit per channel formats are modified in place (all mipmap levels), other formats are converted to RGBA and back
 void ImageColorInvert(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    // Bytes to flip (255 - x is x^0xff) for every 16 bytes of pixel data, alpha is left untouched
+    unsigned char mask[16] = { 0 };
+    int bytesPerPixel = 0;
 
-    for (int i = 0; i < image->width*image->height; i++)
+    switch (image->format)
     {
-        pixels[i].r = 255 - pixels[i].r;
-        pixels[i].g = 255 - pixels[i].g;
-        pixels[i].b = 255 - pixels[i].b;
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: for (int i = 0; i < 16; i++) mask[i] = 0xff; bytesPerPixel = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: for (int i = 0; i < 16; i++) mask[i] = (i%2 == 0)? 0xff : 0; bytesPerPixel = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: for (int i = 0; i < 16; i++) mask[i] = 0xff; bytesPerPixel = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: for (int i = 0; i < 16; i++) mask[i] = (i%4 != 3)? 0xff : 0; bytesPerPixel = 4; break;
+        default: break;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
+    if (bytesPerPixel > 0)
+    {
+        unsigned char *data = (unsigned char *)image->data;
+        int size = GetImagePixelCount(*image)*bytesPerPixel;
+        int i = 0;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    #if defined(RL_TEXTURES_SSE2)
+        __m128i flip = _mm_loadu_si128((__m128i *)mask);
 
-    ImageFormat(image, format);
+        for (; i + 16 <= size; i += 16) _mm_storeu_si128((__m128i *)(data + i), _mm_xor_si128(_mm_loadu_si128((__m128i *)(data + i)), flip));
+    #endif
+
+        for (; i < size; i++) data[i] ^= mask[i%16];
+
+        return;
+    }
+
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR_INVERT;
+
+    unsigned char tables[4][256] = { 0 };
+    GetColorOperationTables(operation, tables);
+    ImageApplyColorTables(image, tables);
 }
 
 // Modify image color: grayscale
+// NOTE: R8G8B8A8 and R8G8B8 are converted in place (all mipmap levels), other formats through ImageFormat()
 void ImageColorGrayscale(Image *image)
-{
-    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
-}
-
-// Modify image color: contrast
-// NOTE: Contrast values between -100 and 100
-void ImageColorContrast(Image *image, float contrast)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (contrast < -100) contrast = -100;
-    if (contrast > 100) contrast = 100;
-
-    contrast = (100.0f + contrast)/100.0f;
-    contrast *= contrast;
+    if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8))
+    {
+        ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+        return;
+    }
 
-    Color *pixels = LoadImageColors(*image);
+    unsigned char *data = (unsigned char *)image->data;
+    int count = GetImagePixelCount(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
+    // NOTE: Same float math as ImageFormat(), so both give the same gray values.
+    // Every gray pixel is written at or before the pixel it was read from, so it can be done in place
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ConvertColorsToGray(data, data, count);
+    else
     {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
-
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
-
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
-
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
+        for (int i = 0; i < count; i++)
+        {
+            data[i] = (unsigned char)(((float)data[i*3]/255.0f*0.299f + (float)data[i*3 + 1]/255.0f*0.587f + (float)data[i*3 + 2]/255.0f*0.114f)*255.0f);
+        }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
+    void *gray = RL_REALLOC(image->data, count);
+    if (gray != NULL) image->data = gray;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image->format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+}
 
-    ImageFormat(image, format);
+// Modify image color: contrast
+// NOTE: Contrast values between -100 and 100
+void ImageColorContrast(Image *image, float contrast)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR_CONTRAST;
+    operation.value = contrast;
+
+    unsigned char tables[4][256] = { 0 };
+    GetColorOperationTables(operation, tables);
+    ImageApplyColorTables(image, tables);
 }
 
 // Modify image color: brightness
@@ -2863,272 +3255,636 @@ void ImageColorBrightness(Image *image, int brightness)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    if (brightness < -255) brightness = -255;
-    if (brightness > 255) brightness = 255;
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR_BRIGHTNESS;
+    operation.value = (float)brightness;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        int cR = pixels[i].r + brightness;
-        int cG = pixels[i].g + brightness;
-        int cB = pixels[i].b + brightness;
-
-        if (cR < 0) cR = 1;
-        if (cR > 255) cR = 255;
-
-        if (cG < 0) cG = 1;
-        if (cG > 255) cG = 255;
-
-        if (cB < 0) cB = 1;
-        if (cB > 255) cB = 255;
-
-        pixels[i].r = (unsigned char)cR;
-        pixels[i].g = (unsigned char)cG;
-        pixels[i].b = (unsigned char)cB;
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    unsigned char tables[4][256] = { 0 };
+    GetColorOperationTables(operation, tables);
+    ImageApplyColorTables(image, tables);
 }
 
 // Modify image color: replace color
+// NOTE: 8-bit per channel formats are modified in place (all mipmap levels), other formats are converted to RGBA and back
 void ImageColorReplace(Image *image, Color color, Color replace)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    unsigned char *data = (unsigned char *)image->data;
+    int count = GetImagePixelCount(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
+    switch (image->format)
     {
-        if ((pixels[i].r == color.r) &&
-            (pixels[i].g == color.g) &&
-            (pixels[i].b == color.b) &&
-            (pixels[i].a == color.a))
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
         {
-            pixels[i].r = replace.r;
-            pixels[i].g = replace.g;
-            pixels[i].b = replace.b;
-            pixels[i].a = replace.a;
-        }
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            unsigned int match = 0;
+            unsigned int replacement = 0;
+            memcpy(&match, &color, 4);
+            memcpy(&replacement, &replace, 4);
+            int i = 0;
 
-    ImageFormat(image, format);
-}
-#endif      // SUPPORT_IMAGE_MANIPULATION
+        #if defined(RL_TEXTURES_SSE2)
+            __m128i matches = _mm_set1_epi32((int)match);
+            __m128i replacements = _mm_set1_epi32((int)replacement);
 
-// Load color data from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImageColors();
-Color *LoadImageColors(Image image)
-{
-    if ((image.width == 0) || (image.height == 0)) return NULL;
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128i pixels = _mm_loadu_si128((__m128i *)(data + i*4));
+                __m128i equal = _mm_cmpeq_epi32(pixels, matches);
+                pixels = _mm_or_si128(_mm_and_si128(equal, replacements), _mm_andnot_si128(equal, pixels));
+                _mm_storeu_si128((__m128i *)(data + i*4), pixels);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                if (memcmp(data + i*4, &match, 4) == 0) memcpy(data + i*4, &replacement, 4);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            // Pixels without alpha read as opaque, so only an opaque color can match
+            if (color.a != 255) break;
 
-    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
+            for (int i = 0; i < count*3; i += 3)
+            {
+                if ((data[i] == color.r) && (data[i + 1] == color.g) && (data[i + 2] == color.b))
+                {
+                    data[i] = replace.r;
+                    data[i + 1] = replace.g;
+                    data[i + 2] = replace.b;
+                }
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // Gray pixels read as r = g = b, so only a gray color can match
+            if ((color.r != color.g) || (color.r != color.b)) break;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
-    {
-        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+            int channels = (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)? 1 : 2;
+            if ((channels == 1) && (color.a != 255)) break;
 
-        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R16) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
+            unsigned char gray = replace.r;
+            if ((replace.r != replace.g) || (replace.r != replace.b)) gray = (unsigned char)(((float)replace.r/255.0f*0.299f + (float)replace.g/255.0f*0.587f + (float)replace.b/255.0f*0.114f)*255.0f);
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
+            for (int i = 0; i < count*channels; i += channels)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                if ((data[i] == color.r) && ((channels == 1) || (data[i + 1] == color.a)))
                 {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
+                    data[i] = gray;
+                    if (channels == 2) data[i + 1] = replace.a;
+                }
+            }
+        } break;
+        default:
+        {
+            Color *pixels = LoadImageColors(*image);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            for (int i = 0; i < image->width*image->height; i++)
+            {
+                if ((pixels[i].r == color.r) &&
+                    (pixels[i].g == color.g) &&
+                    (pixels[i].b == color.b) &&
+                    (pixels[i].a == color.a))
                 {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+                    pixels[i].r = replace.r;
+                    pixels[i].g = replace.g;
+                    pixels[i].b = replace.b;
+                    pixels[i].a = replace.a;
+                }
+            }
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            int format = image->format;
+            RL_FREE(image->data);
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+            image->data = pixels;
+            image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            ImageFormat(image, format);
+        } break;
+    }
+}
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
+// Load an empty image pipeline
+ImagePipeline LoadImagePipeline(void)
+{
+    ImagePipeline pipeline = { 0 };
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    return pipeline;
+}
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+// Unload image pipeline recorded operations
+void UnloadImagePipeline(ImagePipeline pipeline)
+{
+    RL_FREE(pipeline.operations);
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
+// Record image operation: resize (Bicubic scaling algorithm)
+void ImagePipelineResize(ImagePipeline *pipeline, int newWidth, int newHeight)
+{
+    if ((newWidth <= 0) || (newHeight <= 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Pipeline resize size not valid (%i x %i)", newWidth, newHeight);
+        return;
+    }
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_RESIZE;
+    operation.width = newWidth;
+    operation.height = newHeight;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+    AddImagePipelineOperation(pipeline, operation);
+}
 
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
+// Record image operation: resize (Nearest-Neighbor scaling algorithm)
+void ImagePipelineResizeNN(ImagePipeline *pipeline, int newWidth, int newHeight)
+{
+    if ((newWidth <= 0) || (newHeight <= 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Pipeline resize size not valid (%i x %i)", newWidth, newHeight);
+        return;
+    }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_RESIZE_NN;
+    operation.width = newWidth;
+    operation.height = newHeight;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+    AddImagePipelineOperation(pipeline, operation);
+}
 
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = 255;
+// Record image operation: color tint
+void ImagePipelineColorTint(ImagePipeline *pipeline, Color color)
+{
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR_TINT;
+    operation.color = color;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
+    AddImagePipelineOperation(pipeline, operation);
+}
 
-                    k += 4;
-                } break;
-                default: break;
-            }
+// Record image operation: color invert
+void ImagePipelineColorInvert(ImagePipeline *pipeline)
+{
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR_INVERT;
+
+    AddImagePipelineOperation(pipeline, operation);
+}
+
+// Record image operation: color grayscale
+// NOTE: Unlike ImageColorGrayscale(), alpha and image format are kept (r = g = b = gray)
+void ImagePipelineColorGrayscale(ImagePipeline *pipeline)
+{
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR_GRAYSCALE;
+
+    AddImagePipelineOperation(pipeline, operation);
+}
+
+// Record image operation: color contrast
+// NOTE: Contrast values between -100 and 100
+void ImagePipelineColorContrast(ImagePipeline *pipeline, float contrast)
+{
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR_CONTRAST;
+    operation.value = contrast;
+
+    AddImagePipelineOperation(pipeline, operation);
+}
+
+// Record image operation: color brightness
+// NOTE: Brightness values between -255 and 255
+void ImagePipelineColorBrightness(ImagePipeline *pipeline, int brightness)
+{
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR_BRIGHTNESS;
+    operation.value = (float)brightness;
+
+    AddImagePipelineOperation(pipeline, operation);
+}
+
+// Record image operation: replace color
+void ImagePipelineColorReplace(ImagePipeline *pipeline, Color color, Color replace)
+{
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR_REPLACE;
+    operation.color = color;
+    operation.replace = replace;
+
+    AddImagePipelineOperation(pipeline, operation);
+}
+
+// Record image operation: premultiply alpha channel
+void ImagePipelineAlphaPremultiply(ImagePipeline *pipeline)
+{
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_ALPHA_PREMULTIPLY;
+
+    AddImagePipelineOperation(pipeline, operation);
+}
+
+// Record image operation: generate all mipmap levels
+// NOTE: Mipmaps are always generated last, wherever recorded, every level is a 2x2 box filter of the previous one
+void ImagePipelineMipmaps(ImagePipeline *pipeline)
+{
+    ImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_MIPMAPS;
+
+    AddImagePipelineOperation(pipeline, operation);
+}
+
+// Apply all image pipeline operations to image
+// NOTE 1: Operations are run in passes, one per resize: every pass reads the source once and writes every destination row
+// with all the point operations (tint, invert, contrast, brightness, grayscale, replace, premultiply) applied on the way.
+// Consecutive tint, invert, contrast and brightness operations are folded into a single lookup table.
+// NOTE 2: Output is allocated once (mipmaps included), more than one resize needs one intermediate buffer per extra resize
+// NOTE 3: Pixels are processed as RGBA and converted back to the image format at the end (base level only as input).
+// Only R8G8B8A8, R32G32B32 and R32G32B32A32 keep every RGBA value between operations the same way, the Image*() functions
+// reduce other formats to their own channels and precision after every operation, so those run the operations one by one
+void ImageApplyPipeline(Image *image, ImagePipeline pipeline)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (pipeline.operationCount == 0)) return;
+
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Pipeline not supported for compressed formats");
+        return;
+    }
+
+    const ImageOperation *operations = pipeline.operations;
+    int count = pipeline.operationCount;
+
+    if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R32G32B32) &&
+        (image->format != PIXELFORMAT_UNCOMPRESSED_R32G32B32A32))
+    {
+        ApplyImagePipelineOperations(image, operations, count);
+        return;
+    }
+
+    // Final size and mipmap levels, to allocate output only once
+    int width = image->width;
+    int height = image->height;
+    bool mipmaps = false;
+    bool resizes = false;
+
+    for (int i = 0; i < count; i++)
+    {
+        if ((operations[i].type == IMAGE_OPERATION_RESIZE) || (operations[i].type == IMAGE_OPERATION_RESIZE_NN))
+        {
+            width = operations[i].width;
+            height = operations[i].height;
+            resizes = true;
+        }
+        else if (operations[i].type == IMAGE_OPERATION_MIPMAPS) mipmaps = true;
+    }
+
+    int mipCount = 1;
+    int outputSize = width*height*4;
+
+    if (mipmaps)
+    {
+        int mipWidth = width;
+        int mipHeight = height;
+
+        while ((mipWidth != 1) || (mipHeight != 1))
+        {
+            if (mipWidth != 1) mipWidth /= 2;
+            if (mipHeight != 1) mipHeight /= 2;
+
+            mipCount++;
+            outputSize += mipWidth*mipHeight*4;
+        }
+    }
+
+    // R32G32B32 has no alpha channel, its pixels are kept opaque through all the operations
+    bool alpha = (image->format != PIXELFORMAT_UNCOMPRESSED_R32G32B32);
+
+    ImagePipelineStep *steps = (ImagePipelineStep *)RL_MALLOC(count*sizeof(ImagePipelineStep));
+    unsigned char *output = NULL;
+    unsigned char *buffer = NULL;       // Intermediate pixels between two resizes
+
+    ImagePipelineJob job = { 0 };
+    job.src = (const unsigned char *)image->data;
+    job.srcFormat = image->format;
+    job.srcWidth = image->width;
+    job.srcHeight = image->height;
+
+    // Without resizing RGBA pixels are processed in place, grown to fit mipmaps
+    if (!resizes && (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        output = (unsigned char *)RL_REALLOC(image->data, outputSize);
+
+        if (output == NULL)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Pipeline output memory could not be allocated");
+            RL_FREE(steps);
+            return;
+        }
+
+        image->data = output;
+        job.src = output;
+    }
+
+    int first = 0;      // First operation of the pass
+    bool done = false;
+
+    while (!done)
+    {
+        // Pass: point operations [first, resize), resize, then the operations after it if it is the last resize
+        int resize = first;
+        while ((resize < count) && (operations[resize].type != IMAGE_OPERATION_RESIZE) && (operations[resize].type != IMAGE_OPERATION_RESIZE_NN)) resize++;
+
+        int next = resize + 1;
+        while ((next < count) && (operations[next].type != IMAGE_OPERATION_RESIZE) && (operations[next].type != IMAGE_OPERATION_RESIZE_NN)) next++;
+
+        done = (next >= count);
+
+        job.srcBytesPerPixel = GetPixelDataSize(1, 1, job.srcFormat);
+        job.inputSteps = steps;
+        job.inputStepCount = CompileImagePipelineSteps(operations + first, resize - first, alpha, steps);
+        job.outputSteps = steps + job.inputStepCount;
+        job.outputStepCount = 0;
+        if (done && (resize < count)) job.outputStepCount = CompileImagePipelineSteps(operations + resize + 1, count - resize - 1, alpha, steps + job.inputStepCount);
+
+        job.dstWidth = (resize < count)? operations[resize].width : job.srcWidth;
+        job.dstHeight = (resize < count)? operations[resize].height : job.srcHeight;
+
+        if (done && (output == NULL)) output = (unsigned char *)RL_MALLOC(outputSize);
+        job.dst = done? output : (unsigned char *)RL_MALLOC(job.dstWidth*job.dstHeight*4);
+
+        if (job.dst == NULL)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Pipeline output memory could not be allocated");
+            RL_FREE(buffer);
+            RL_FREE(steps);
+            return;
+        }
+
+        if (resize >= count) ImageParallelFor(job.dstHeight, 16, ImagePipelineRows, &job);
+        else if (operations[resize].type == IMAGE_OPERATION_RESIZE_NN) ImageParallelFor(job.dstHeight, 16, ImagePipelineRowsNN, &job);
+        else
+        {
+            // NOTE: Same stb scaling filters as ImageResize(), source conversion and steps are done in the scanline callbacks
+            STBIR_RESIZE resizer = { 0 };
+            stbir_resize_init(&resizer, job.src, job.srcWidth, job.srcHeight, 0,
+                job.dst, job.dstWidth, job.dstHeight, job.dstWidth*4, (stbir_pixel_layout)4, STBIR_TYPE_UINT8);
+
+            bool inputCallback = (job.srcFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (job.inputStepCount > 0);
+            stbir_set_pixel_callbacks(&resizer, inputCallback? ImagePipelineInputCallback : NULL, (job.outputStepCount > 0)? ImagePipelineOutputCallback : NULL);
+            stbir_set_user_data(&resizer, &job);
+            job.resize = &resizer;
+
+            int splits = stbir_build_samplers_with_splits(&resizer, GetImageThreadCount());
+
+            if (splits > 0) ImageParallelFor(splits, 1, ImagePipelineResizeSplits, &job);
+            else TRACELOG(LOG_WARNING, "IMAGE: Pipeline resize failed");
+
+            stbir_free_samplers(&resizer);
+        }
+
+        // Destination is the source of the next pass
+        RL_FREE(buffer);
+        buffer = done? NULL : job.dst;
+
+        job.src = job.dst;
+        job.srcFormat = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        job.srcWidth = job.dstWidth;
+        job.srcHeight = job.dstHeight;
+        first = resize + 1;
+    }
+
+    RL_FREE(steps);
+
+    // Mipmap levels, every one from the previous level
+    if (mipCount > 1) GenImageMipmapLevels(output, width, height, 4, 1, mipCount, false);
+
+    int format = image->format;
+
+    if (image->data != output) RL_FREE(image->data);
+    image->data = output;
+    image->width = width;
+    image->height = height;
+    image->mipmaps = mipCount;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    // Back to the image format, level by level so the box filtered mipmaps are kept
+    if ((format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (mipCount == 1)) ImageFormat(image, format);
+    else if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        int formatSize = 0;
+        int mipWidth = width;
+        int mipHeight = height;
+
+        for (int i = 0; i < mipCount; i++)
+        {
+            formatSize += GetPixelDataSize(mipWidth, mipHeight, format);
+            if (mipWidth != 1) mipWidth /= 2;
+            if (mipHeight != 1) mipHeight /= 2;
+        }
+
+        unsigned char *formatted = (unsigned char *)RL_MALLOC(formatSize);
+
+        if (formatted == NULL)
+        {
+            // Image is left as R8G8B8A8, mipmaps included
+            TRACELOG(LOG_WARNING, "IMAGE: Pipeline output memory could not be allocated");
+            return;
+        }
+
+        unsigned char *level = output;
+        unsigned char *formattedLevel = formatted;
+        mipWidth = width;
+        mipHeight = height;
+
+        for (int i = 0; i < mipCount; i++)
+        {
+            Image levelImage = { level, mipWidth, mipHeight, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+            Image converted = ImageCopy(levelImage);
+            ImageFormat(&converted, format);
+
+            int levelSize = GetPixelDataSize(mipWidth, mipHeight, format);
+            memcpy(formattedLevel, converted.data, levelSize);
+            UnloadImage(converted);
+
+            level += mipWidth*mipHeight*4;
+            formattedLevel += levelSize;
+            if (mipWidth != 1) mipWidth /= 2;
+            if (mipHeight != 1) mipHeight /= 2;
         }
+
+        RL_FREE(output);
+        image->data = formatted;
+        image->format = format;
+    }
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+// Load color data from image as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImageColors();
+Color *LoadImageColors(Image image)
+{
+    if ((image.width == 0) || (image.height == 0)) return NULL;
+
+    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
+
+    if (pixels == NULL) TRACELOG(LOG_WARNING, "IMAGE: Color data memory could not be allocated");
+    else if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R16) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
+
+        ConvertPixelsToColors(image.data, image.format, image.width*image.height, pixels);
     }
 
     return pixels;
 }
 
 // Load colors palette from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImagePalette()
+// NOTE 1: Memory allocated should be freed using UnloadImagePalette()
+// NOTE 2: Colors are found in one pass over the pixels through a hash table, in the order they first appear
 Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+    *colorCount = 0;
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0) || (maxPaletteSize < 1)) return NULL;
 
-    int palCount = 0;
-    Color *palette = NULL;
-    Color *pixels = LoadImageColors(image);
+    Color *palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+    for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
-    if (pixels != NULL)
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+        return palette;
+    }
+
+    // Single band, it stops as soon as the palette is full
+    ImagePaletteJob job = { 0 };
+    job.data = (const unsigned char *)image.data;
+    job.format = image.format;
+    job.bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+    job.pixelCount = image.width*image.height;
+    job.maxPaletteSize = maxPaletteSize;
+    job.bandCount = 1;
+    LoadColorTable(&job.bands[0].table, maxPaletteSize);
+    job.bands[0].colors = palette;
+    job.bands[0].counts = (int *)RL_CALLOC(maxPaletteSize, sizeof(int));
+
+    ImagePaletteBands(&job, 0, 1);
+
+    *colorCount = job.bands[0].colorCount;
+    if (*colorCount >= maxPaletteSize) TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+
+    UnloadColorTable(&job.bands[0].table);
+    RL_FREE(job.bands[0].counts);
+
+    return palette;
+}
+
+// Load colors palette from image as a Color array (RGBA - 32bit), with the number of pixels of every color
+// NOTE 1: Same palette as LoadImagePalette(), counts must have room for maxPaletteSize values (or be NULL to skip counting)
+// NOTE 2: Pixels are split in bands across threads, every band finds its own colors and counts, then they are merged in order
+Color *LoadImagePaletteCounts(Image image, int maxPaletteSize, int *colorCount, int *counts)
+{
+    if (counts == NULL) return LoadImagePalette(image, maxPaletteSize, colorCount);
+
+    *colorCount = 0;
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0) || (maxPaletteSize < 1)) return NULL;
+
+    Color *palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+    for (int i = 0; i < maxPaletteSize; i++)
+    {
+        palette[i] = BLANK;
+        counts[i] = 0;
+    }
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+        return palette;
+    }
+
+    ImagePaletteJob job = { 0 };
+    job.data = (const unsigned char *)image.data;
+    job.format = image.format;
+    job.bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+    job.pixelCount = image.width*image.height;
+    job.maxPaletteSize = maxPaletteSize;
+
+    // At least 64K pixels per band, not worth a thread below that
+    job.bandCount = GetImageThreadCount();
+    if (job.bandCount > job.pixelCount/65536 + 1) job.bandCount = job.pixelCount/65536 + 1;
+
+    for (int b = 0; b < job.bandCount; b++)
     {
-        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+        LoadColorTable(&job.bands[b].table, maxPaletteSize);
+        job.bands[b].colors = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+        job.bands[b].counts = (int *)RL_CALLOC(maxPaletteSize, sizeof(int));
+    }
+
+    ImageParallelFor(job.bandCount, 1, ImagePaletteBands, &job);
+
+    // Merge bands in order: colors keep the order they first appear in the image
+    ColorTable table = { 0 };
+    LoadColorTable(&table, maxPaletteSize);
+    int palCount = 0;
+    bool recount = false;
 
-        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
+    for (int b = 0; b < job.bandCount; b++)
+    {
+        ImagePaletteBand *band = &job.bands[b];
 
-        for (int i = 0; i < image.width*image.height; i++)
+        for (int i = 0; i < band->colorCount; i++)
         {
-            if (pixels[i].a > 0)
+            unsigned int key = 0;
+            memcpy(&key, &band->colors[i], 4);
+            int slot = GetColorTableSlot(&table, key);
+
+            if (table.keys[slot] == key) counts[table.indices[slot]] += band->counts[i];
+            else if (palCount < maxPaletteSize)
             {
-                bool colorInPalette = false;
+                table.keys[slot] = key;
+                table.indices[slot] = palCount;
+                palette[palCount] = band->colors[i];
+                counts[palCount] = band->counts[i];
+                palCount++;
+            }
+        }
 
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
-                {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
-                    {
-                        colorInPalette = true;
-                        break;
-                    }
-                }
+        // A band that reached the palette size stopped early, its pixels have to be counted again
+        if (band->full) recount = true;
+    }
 
-                // Store color if not on the palette
-                if (!colorInPalette)
-                {
-                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                    palCount++;
+    if (recount)
+    {
+        for (int b = 0; b < job.bandCount; b++) memset(job.bands[b].counts, 0, maxPaletteSize*sizeof(int));
 
-                    // We reached the limit of colors supported by palette
-                    if (palCount >= maxPaletteSize)
-                    {
-                        i = image.width*image.height;   // Finish palette get
-                        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
-                    }
-                }
-            }
+        job.palette = &table;
+        ImageParallelFor(job.bandCount, 1, ImagePaletteCountBands, &job);
+
+        for (int i = 0; i < palCount; i++)
+        {
+            counts[i] = 0;
+            for (int b = 0; b < job.bandCount; b++) counts[i] += job.bands[b].counts[i];
         }
+    }
 
-        UnloadImageColors(pixels);
+    if (palCount >= maxPaletteSize) TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+
+    for (int b = 0; b < job.bandCount; b++)
+    {
+        UnloadColorTable(&job.bands[b].table);
+        RL_FREE(job.bands[b].colors);
+        RL_FREE(job.bands[b].counts);
     }
+    UnloadColorTable(&table);
 
     *colorCount = palCount;
 
@@ -3141,7 +3897,7 @@ void UnloadImageColors(Color *colors)
     RL_FREE(colors);
 }
 
-// Unload colors palette loaded with LoadImagePalette()
+// Unload colors palette loaded with LoadImagePalette() or LoadImagePaletteCounts()
 void UnloadImagePalette(Color *colors)
 {
     RL_FREE(colors);
@@ -4131,31 +4887,385 @@ Texture2D LoadTextureFromImage(Image image)
     return texture;
 }
 
-// Load cubemap from image, multiple image cubemap layouts supported
-TextureCubemap LoadTextureCubemap(Image image, int layout)
+// Load texture from file into GPU memory (VRAM), decoding image data in the background
+// NOTE: Returned texture is a placeholder with the final size and format, contents are undefined
+// until UpdateTextureQueue() uploads the decoded image, file formats without a readable header
+// (DDS, KTX, HDR...) are loaded right away
+Texture2D LoadTextureAsync(const char *fileName)
 {
-    TextureCubemap cubemap = { 0 };
+    Texture2D texture = { 0 };
 
-    if (layout == CUBEMAP_LAYOUT_AUTO_DETECT)      // Try to automatically guess layout type
+    // NOTE: File is mapped if possible, its pages are then read from disk by the worker decoding it
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileMapped(fileName, &dataSize);
+    bool mapped = (fileData != NULL);
+
+    if (!mapped) fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData == NULL) return texture;
+
+    const char *fileType = GetFileExtension(fileName);
+    int width = 0;
+    int height = 0;
+    int format = 0;
+
+    if ((fileType == NULL) || (strlen(fileType) >= 16) || !GetImageInfoFromMemory(fileType, fileData, dataSize, &width, &height, &format))
     {
-        // Check image width/height to determine the type of cubemap provided
-        if (image.width > image.height)
-        {
-            if ((image.width/6) == image.height) { layout = CUBEMAP_LAYOUT_LINE_HORIZONTAL; cubemap.width = image.width/6; }
-            else if ((image.width/4) == (image.height/3)) { layout = CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
-        }
-        else if (image.height > image.width)
+        Image image = LoadImageFromMemory(fileType, fileData, dataSize);
+
+        if (mapped) UnloadFileMapped(fileData, dataSize);
+        else UnloadFileData(fileData);
+
+        if (image.data != NULL)
         {
-            if ((image.height/6) == image.width) { layout = CUBEMAP_LAYOUT_LINE_VERTICAL; cubemap.width = image.height/6; }
-            else if ((image.width/3) == (image.height/4)) { layout = CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
+            texture = LoadTextureFromImage(image);
+            UnloadImage(image);
         }
-    }
-    else
-    {
-        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL) cubemap.width = image.height/6;
-        if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) cubemap.width = image.width/6;
-        if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR) cubemap.width = image.width/3;
-        if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE) cubemap.width = image.width/4;
+
+        return texture;
+    }
+
+    texture.id = rlLoadTexture(NULL, width, height, format, 1);
+
+    if (texture.id == 0)
+    {
+        if (mapped) UnloadFileMapped(fileData, dataSize);
+        else UnloadFileData(fileData);
+
+        return texture;
+    }
+
+    texture.width = width;
+    texture.height = height;
+    texture.mipmaps = 1;
+    texture.format = format;
+
+    TextureQueueJob *job = (TextureQueueJob *)RL_CALLOC(1, sizeof(TextureQueueJob));
+    job->id = texture.id;
+    job->width = width;
+    job->height = height;
+    job->format = format;
+    strcpy(job->fileType, fileType);
+    job->fileData = fileData;
+    job->dataSize = dataSize;
+    job->mapped = mapped;
+
+    if (textureQueue.jobCount == textureQueue.jobCapacity)
+    {
+        textureQueue.jobCapacity = (textureQueue.jobCapacity == 0)? 64 : textureQueue.jobCapacity*2;
+        textureQueue.jobs = (TextureQueueJob **)RL_REALLOC(textureQueue.jobs, textureQueue.jobCapacity*sizeof(TextureQueueJob *));
+    }
+
+    textureQueue.jobs[textureQueue.jobCount] = job;
+    textureQueue.jobCount++;
+
+#if defined(RL_TEXTURES_THREADS)
+    SendTextureQueueJobs();     // Start decoding right away
+#endif
+
+    TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture queued for loading (%i x %i)", texture.id, width, height);
+
+    return texture;
+}
+
+// Upload decoded textures of the loading queue to GPU memory (VRAM), for up to budget milliseconds
+// NOTE: Call it once per frame, at least one texture is uploaded every call if any is decoded
+void UpdateTextureQueue(float budget)
+{
+    double startTime = GetTime();
+    int uploadCount = 0;
+
+#if defined(RL_TEXTURES_THREADS)
+    for (int i = 0; i < textureQueue.workerCount; i++)
+    {
+        TextureQueueWorker *worker = &textureQueue.workers[i];
+        TextureQueueJob *job = NULL;
+
+        while (((uploadCount == 0) || ((GetTime() - startTime)*1000.0 < budget)) && PopTextureQueueJob(&worker->results, &job))
+        {
+            worker->jobCount--;
+            if (!job->canceled) uploadCount++;
+
+            UploadTextureQueueJob(job);
+        }
+    }
+
+    SendTextureQueueJobs();
+
+    // Join workers that ran out of jobs, they are exiting or already gone
+    for (int i = 0; i < textureQueue.workerCount; i++)
+    {
+        TextureQueueWorker *worker = &textureQueue.workers[i];
+
+        if (worker->started && (worker->jobCount == 0) && (ATOMIC_LOAD(&worker->running) == 0))
+        {
+        #if defined(RL_TEXTURES_THREADS_WIN32)
+            WaitForSingleObject((void *)worker->handle, 0xffffffff);    // INFINITE
+            CloseHandle((void *)worker->handle);
+        #else
+            pthread_join(worker->handle, NULL);
+        #endif
+            worker->started = false;
+        }
+    }
+#else
+    // No worker threads, images are decoded here within the same budget
+    while ((textureQueue.jobCount > 0) && ((uploadCount == 0) || ((GetTime() - startTime)*1000.0 < budget)))
+    {
+        TextureQueueJob *job = textureQueue.jobs[0];
+
+        job->image = LoadImageFromMemory(job->fileType, job->fileData, job->dataSize);
+        if (job->mapped) UnloadFileMapped(job->fileData, job->dataSize);
+        else UnloadFileData(job->fileData);
+        job->fileData = NULL;
+
+        UploadTextureQueueJob(job);
+        uploadCount++;
+    }
+#endif
+}
+
+// Check if a texture is waiting in the loading queue (placeholder not uploaded yet)
+bool IsTextureQueued(Texture2D texture)
+{
+    bool result = false;
+
+    for (int i = 0; i < textureQueue.jobCount; i++)
+    {
+        if ((textureQueue.jobs[i]->id == texture.id) && !textureQueue.jobs[i]->canceled)
+        {
+            result = true;
+            break;
+        }
+    }
+
+    return result;
+}
+
+// Get number of textures waiting in the loading queue
+int GetTextureQueueCount(void)
+{
+    int count = 0;
+
+    for (int i = 0; i < textureQueue.jobCount; i++) if (!textureQueue.jobs[i]->canceled) count++;
+
+    return count;
+}
+
+// Unload texture loading queue: workers stopped and joined, jobs still queued dropped with their placeholder textures
+// NOTE: Called by CloseWindow() while the OpenGL context is still there, the queue can be used again after InitWindow()
+extern void UnloadTextureQueue(void)
+{
+#if defined(RL_TEXTURES_THREADS)
+    // Workers finish the image they are decoding and exit, jobs left in their rings are still in the queue
+    ATOMIC_STORE(&textureQueue.stop, 1);
+
+    for (int i = 0; i < textureQueue.workerCount; i++)
+    {
+        TextureQueueWorker *worker = &textureQueue.workers[i];
+
+        if (worker->started)
+        {
+        #if defined(RL_TEXTURES_THREADS_WIN32)
+            WaitForSingleObject((void *)worker->handle, 0xffffffff);    // INFINITE
+            CloseHandle((void *)worker->handle);
+        #else
+            pthread_join(worker->handle, NULL);
+        #endif
+        }
+    }
+#endif
+
+    for (int i = 0; i < textureQueue.jobCount; i++)
+    {
+        TextureQueueJob *job = textureQueue.jobs[i];
+
+        // Canceled jobs had their texture unloaded already
+        if (!job->canceled) rlUnloadTexture(job->id);
+
+        UnloadImage(job->image);
+        if (job->mapped) UnloadFileMapped(job->fileData, job->dataSize);
+        else UnloadFileData(job->fileData);
+        RL_FREE(job);
+    }
+
+    if (textureQueue.jobCount > 0) TRACELOG(LOG_INFO, "TEXTURE: Texture loading queue unloaded, %i textures dropped", textureQueue.jobCount);
+
+    RL_FREE(textureQueue.jobs);
+    memset(&textureQueue, 0, sizeof(TextureQueue));
+}
+
+// Load an empty texture atlas, pages of width x height (R8G8B8A8) are added as required
+// NOTE: Images get a gutter of padding pixels repeating their edge pixels, see LoadImageAtlas()
+TextureAtlas LoadTextureAtlas(int width, int height, int padding)
+{
+    TextureAtlas atlas = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (padding < 0))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Atlas parameters are not valid");
+        return atlas;
+    }
+
+    atlas.width = width;
+    atlas.height = height;
+    atlas.padding = padding;
+
+    return atlas;
+}
+
+// Pack image into a texture atlas, returns its region (page -1 if it could not be packed)
+// NOTE: Pages are tried in order, a new page is added when none has room left,
+// image pixels are uploaded right away to the region of the page texture
+AtlasRegion AddTextureAtlasImage(TextureAtlas *atlas, Image image)
+{
+    AtlasRegion region = { 0 };
+    region.page = -1;
+
+    if (atlas == NULL) return region;
+
+    int packWidth = image.width + 2*atlas->padding;
+    int packHeight = image.height + 2*atlas->padding;
+
+    if ((image.data == NULL) || (image.width <= 0) || (image.height <= 0) || (atlas->width <= 0)) return region;
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Atlas image pixel format is compressed, it can not be packed");
+        return region;
+    }
+    if ((packWidth > atlas->width) || (packHeight > atlas->height))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Atlas image bigger than atlas page (%i x %i)", atlas->width, atlas->height);
+        return region;
+    }
+
+    TextureAtlasPacker **packers = (TextureAtlasPacker **)atlas->packers;
+    stbrp_rect rect = { 0 };
+    rect.w = packWidth;
+    rect.h = packHeight;
+
+    int page = 0;
+    for (; page < atlas->pageCount; page++)
+    {
+        stbrp_pack_rects(&packers[page]->context, &rect, 1);
+        if (rect.was_packed) break;
+    }
+
+    if (page == atlas->pageCount)
+    {
+        // Add a new page, cleared to transparent
+        Image pageImage = { 0 };
+        pageImage.data = RL_CALLOC(atlas->width*atlas->height, sizeof(Color));
+        pageImage.width = atlas->width;
+        pageImage.height = atlas->height;
+        pageImage.mipmaps = 1;
+        pageImage.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        if (pageImage.data == NULL)
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: Atlas page memory could not be allocated");
+            return region;
+        }
+
+        Texture2D texture = LoadTextureFromImage(pageImage);
+        UnloadImage(pageImage);
+
+        if (texture.id == 0) return region;
+
+        TextureAtlasPacker *packer = (TextureAtlasPacker *)RL_CALLOC(1, sizeof(TextureAtlasPacker));
+        stbrp_node *nodes = (stbrp_node *)RL_MALLOC(atlas->width*sizeof(stbrp_node));
+
+        // Arrays grow one at a time, a failed reallocation leaves the old one in place
+        Texture2D *pages = (Texture2D *)RL_REALLOC(atlas->pages, (atlas->pageCount + 1)*sizeof(Texture2D));
+        if (pages != NULL) atlas->pages = pages;
+        TextureAtlasPacker **grownPackers = (TextureAtlasPacker **)RL_REALLOC(packers, (atlas->pageCount + 1)*sizeof(TextureAtlasPacker *));
+        if (grownPackers != NULL) atlas->packers = packers = grownPackers;
+
+        if ((packer == NULL) || (nodes == NULL) || (pages == NULL) || (grownPackers == NULL))
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: Atlas page memory could not be allocated");
+            UnloadTexture(texture);
+            RL_FREE(nodes);
+            RL_FREE(packer);
+            return region;
+        }
+
+        packer->nodes = nodes;
+        stbrp_init_target(&packer->context, atlas->width, atlas->height, packer->nodes, atlas->width);
+
+        atlas->pages[atlas->pageCount] = texture;
+        packers[atlas->pageCount] = packer;
+        atlas->pageCount++;
+
+        stbrp_pack_rects(&packer->context, &rect, 1);     // Always fits an empty page
+    }
+
+    // Image with its gutter, uploaded as a single block
+    // NOTE: If memory runs out here the page space stays taken, the image is just not uploaded
+    Color *pixels = LoadImageColors(image);
+    Color *block = (Color *)RL_MALLOC(packWidth*packHeight*sizeof(Color));
+
+    if ((pixels == NULL) || (block == NULL))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Atlas image memory could not be allocated");
+        RL_FREE(block);
+        UnloadImageColors(pixels);
+        return region;
+    }
+
+    CopyAtlasPixels(block, packWidth, pixels, image.width, image.height, 0, 0, atlas->padding);
+    rlUpdateTexture(atlas->pages[page].id, rect.x, rect.y, packWidth, packHeight, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, block);
+
+    RL_FREE(block);
+    UnloadImageColors(pixels);
+
+    region.page = page;
+    region.rec = (Rectangle){ (float)(rect.x + atlas->padding), (float)(rect.y + atlas->padding), (float)image.width, (float)image.height };
+
+    return region;
+}
+
+// Unload texture atlas pages from GPU memory (VRAM)
+void UnloadTextureAtlas(TextureAtlas atlas)
+{
+    TextureAtlasPacker **packers = (TextureAtlasPacker **)atlas.packers;
+
+    for (int i = 0; i < atlas.pageCount; i++)
+    {
+        UnloadTexture(atlas.pages[i]);
+        RL_FREE(packers[i]->nodes);
+        RL_FREE(packers[i]);
+    }
+
+    RL_FREE(packers);
+    RL_FREE(atlas.pages);
+}
+
+// Load cubemap from image, multiple image cubemap layouts supported
+TextureCubemap LoadTextureCubemap(Image image, int layout)
+{
+    TextureCubemap cubemap = { 0 };
+
+    if (layout == CUBEMAP_LAYOUT_AUTO_DETECT)      // Try to automatically guess layout type
+    {
+        // Check image width/height to determine the type of cubemap provided
+        if (image.width > image.height)
+        {
+            if ((image.width/6) == image.height) { layout = CUBEMAP_LAYOUT_LINE_HORIZONTAL; cubemap.width = image.width/6; }
+            else if ((image.width/4) == (image.height/3)) { layout = CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE; cubemap.width = image.width/4; }
+        }
+        else if (image.height > image.width)
+        {
+            if ((image.height/6) == image.width) { layout = CUBEMAP_LAYOUT_LINE_VERTICAL; cubemap.width = image.height/6; }
+            else if ((image.width/3) == (image.height/4)) { layout = CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
+        }
+    }
+    else
+    {
+        if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL) cubemap.width = image.height/6;
+        if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) cubemap.width = image.width/6;
+        if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR) cubemap.width = image.width/3;
+        if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE) cubemap.width = image.width/4;
     }
 
     cubemap.height = cubemap.width;
@@ -4295,6 +5405,8 @@ void UnloadTexture(Texture2D texture)
 {
     if (texture.id > 0)
     {
+        if (textureQueue.jobCount > 0) CancelTextureQueueJob(texture.id);
+
         rlUnloadTexture(texture.id);
 
         TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
@@ -5378,110 +6490,669 @@ int GetPixelDataSize(int width, int height, int format)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
-// Convert half-float (stored as unsigned short) to float
-// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
-static float HalfToFloat(unsigned short x)
+// Convert pixel data in an uncompressed format to a Color array (RGBA - 32bit)
+// NOTE: 8-bit and 16-bit formats go through the direct converters, same values as ImageFormat() to RGBA
+static void ConvertPixelsToColors(const void *data, int format, int count, Color *pixels)
 {
-    float result = 0.0f;
+    if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        memcpy(pixels, data, (size_t)count*sizeof(Color));
+        return;
+    }
 
-    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
-    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
-    const float fm = (float)m;
-    const unsigned int v = (*(unsigned int*)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
-    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+    PixelFormatJob job = { 0 };
+    if (GetPixelFormatJob(format, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, &job))
+    {
+        job.toColors(data, pixels, count);
+        return;
+    }
 
-    result = *(float *)&r;
+    for (int i = 0, k = 0; i < count; i++)
+    {
+        switch (format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                pixels[i].r = (unsigned char)(((const float *)data)[k]*255.0f);
+                pixels[i].g = 0;
+                pixels[i].b = 0;
+                pixels[i].a = 255;
 
-    return result;
+                k += 1;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                pixels[i].r = (unsigned char)(((const float *)data)[k]*255.0f);
+                pixels[i].g = (unsigned char)(((const float *)data)[k + 1]*255.0f);
+                pixels[i].b = (unsigned char)(((const float *)data)[k + 2]*255.0f);
+                pixels[i].a = 255;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                pixels[i].r = (unsigned char)(((const float *)data)[k]*255.0f);
+                pixels[i].g = (unsigned char)(((const float *)data)[k + 1]*255.0f);
+                pixels[i].b = (unsigned char)(((const float *)data)[k + 2]*255.0f);
+                pixels[i].a = (unsigned char)(((const float *)data)[k + 3]*255.0f);
+
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16:
+            {
+                pixels[i].r = (unsigned char)(HalfToFloat(((const unsigned short *)data)[k])*255.0f);
+                pixels[i].g = 0;
+                pixels[i].b = 0;
+                pixels[i].a = 255;
+
+                k += 1;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                pixels[i].r = (unsigned char)(HalfToFloat(((const unsigned short *)data)[k])*255.0f);
+                pixels[i].g = (unsigned char)(HalfToFloat(((const unsigned short *)data)[k + 1])*255.0f);
+                pixels[i].b = (unsigned char)(HalfToFloat(((const unsigned short *)data)[k + 2])*255.0f);
+                pixels[i].a = 255;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                pixels[i].r = (unsigned char)(HalfToFloat(((const unsigned short *)data)[k])*255.0f);
+                pixels[i].g = (unsigned char)(HalfToFloat(((const unsigned short *)data)[k + 1])*255.0f);
+                pixels[i].b = (unsigned char)(HalfToFloat(((const unsigned short *)data)[k + 2])*255.0f);
+                pixels[i].a = (unsigned char)(HalfToFloat(((const unsigned short *)data)[k + 3])*255.0f);
+
+                k += 4;
+            } break;
+            default: break;
+        }
+    }
 }
 
-// Convert float to half-float (stored as unsigned short)
-static unsigned short FloatToHalf(float x)
+// Direct converters to RGBA, indexed by source pixel format (8-bit and 16-bit formats)
+static const PixelFormatConverter pixelFormatToColors[PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 + 1] = {
+    NULL,
+    ConvertGrayToColors,        // PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+    ConvertGrayAlphaToColors,   // PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+    ConvertR5G6B5ToColors,      // PIXELFORMAT_UNCOMPRESSED_R5G6B5
+    ConvertR8G8B8ToColors,      // PIXELFORMAT_UNCOMPRESSED_R8G8B8
+    ConvertR5G5B5A1ToColors,    // PIXELFORMAT_UNCOMPRESSED_R5G5B5A1
+    ConvertR4G4B4A4ToColors,    // PIXELFORMAT_UNCOMPRESSED_R4G4B4A4
+    NULL                        // PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+};
+
+// Direct converters from RGBA, indexed by destination pixel format (8-bit and 16-bit formats)
+static const PixelFormatConverter pixelFormatFromColors[PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 + 1] = {
+    NULL,
+    ConvertColorsToGray,        // PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+    ConvertColorsToGrayAlpha,   // PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+    ConvertColorsToR5G6B5,      // PIXELFORMAT_UNCOMPRESSED_R5G6B5
+    ConvertColorsToR8G8B8,      // PIXELFORMAT_UNCOMPRESSED_R8G8B8
+    ConvertColorsToR5G5B5A1,    // PIXELFORMAT_UNCOMPRESSED_R5G5B5A1
+    ConvertColorsToR4G4B4A4,    // PIXELFORMAT_UNCOMPRESSED_R4G4B4A4
+    NULL                        // PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+};
+
+// Get direct converters from srcFormat to dstFormat, false if the pair has to go through normalized float pixels
+// NOTE: Converters give the same values as LoadImageDataNormalized() and the ImageFormat() float math. Sources with
+// 8-bit channels go through RGBA to any 8-bit or 16-bit format. Packed 16-bit sources only go to R8G8B8A8 and R8G8B8,
+// other formats would need their precision that RGBA loses. Float formats have no direct converters
+static bool GetPixelFormatJob(int srcFormat, int dstFormat, PixelFormatJob *job)
 {
-    unsigned short result = 0;
+    if ((srcFormat == dstFormat) || (srcFormat < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcFormat > PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+        (dstFormat < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (dstFormat > PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) return false;
 
-    const unsigned int b = (*(unsigned int*) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
-    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
-    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+    bool srcPacked = (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5) || (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+        (srcFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4);
+    if (srcPacked && (dstFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8)) return false;
 
-    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+    job->srcBytesPerPixel = GetPixelDataSize(1, 1, srcFormat);
+    job->dstBytesPerPixel = GetPixelDataSize(1, 1, dstFormat);
+    job->toColors = pixelFormatToColors[srcFormat];
+    job->fromColors = pixelFormatFromColors[dstFormat];
 
-    return result;
+    return true;
 }
 
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
+// Pixel format conversion task: pixels [start, end) of src into dst
+// NOTE: Without a direct converter between both formats, blocks of pixels go through RGBA
+static void ConvertPixelFormatPixels(void *data, int start, int end)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    PixelFormatJob *job = (PixelFormatJob *)data;
+    const unsigned char *src = job->src + (size_t)start*job->srcBytesPerPixel;
+    unsigned char *dst = job->dst + (size_t)start*job->dstBytesPerPixel;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    if (job->toColors == NULL) job->fromColors(src, dst, end - start);
+    else if (job->fromColors == NULL) job->toColors(src, dst, end - start);
     else
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        Color block[IMAGE_PIPELINE_BLOCK_SIZE];
+
+        for (int i = start; i < end; i += IMAGE_PIPELINE_BLOCK_SIZE)
         {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+            int count = ((end - i) < IMAGE_PIPELINE_BLOCK_SIZE)? (end - i) : IMAGE_PIPELINE_BLOCK_SIZE;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+            job->toColors(src, block, count);
+            job->fromColors(block, dst, count);
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            src += count*job->srcBytesPerPixel;
+            dst += count*job->dstBytesPerPixel;
+        }
+    }
+}
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+#if defined(RL_TEXTURES_SSE2)
+// Expand 5-bit or 6-bit channel values (16bit lanes) to 8 bit: value*255/31 (or /63), truncated
+// NOTE: Division through a multiply by 2^20/31 (2^21/63) rounded up, exact for every value*255
+static inline __m128i ExpandChannelSSE2(__m128i values, int bits)
+{
+    __m128i scaled = _mm_mullo_epi16(values, _mm_set1_epi16(255));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    if (bits == 5) return _mm_srli_epi16(_mm_mulhi_epu16(scaled, _mm_set1_epi16((short)33826)), 4);
+    else return _mm_srli_epi16(_mm_mulhi_epu16(scaled, _mm_set1_epi16((short)33289)), 5);
+}
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+// Reduce 8-bit channel values (16bit lanes) to 0..max: (value*max + 127)/255
+// NOTE: (t + 1 + (t >> 8)) >> 8 is exactly t/255 for any t below 65535
+static inline __m128i ReduceChannelSSE2(__m128i values, int max)
+{
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(values, _mm_set1_epi16((short)max)), _mm_set1_epi16(127));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_set1_epi16(1)), _mm_srli_epi16(t, 8)), 8);
+}
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+// Load 8 RGBA pixels split in channels, 16bit per value
+static inline void LoadColorChannelsSSE2(const unsigned char *colors, __m128i *r, __m128i *g, __m128i *b, __m128i *a)
+{
+    __m128i first = _mm_loadu_si128((const __m128i *)colors);
+    __m128i second = _mm_loadu_si128((const __m128i *)(colors + 16));
+    __m128i byteMask = _mm_set1_epi32(0xff);
+
+    *r = _mm_packs_epi32(_mm_and_si128(first, byteMask), _mm_and_si128(second, byteMask));
+    *g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(first, 8), byteMask), _mm_and_si128(_mm_srli_epi32(second, 8), byteMask));
+    *b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(first, 16), byteMask), _mm_and_si128(_mm_srli_epi32(second, 16), byteMask));
+    *a = _mm_packs_epi32(_mm_srli_epi32(first, 24), _mm_srli_epi32(second, 24));
+}
 
-                } break;
+// Store 8 RGBA pixels from channels, 16bit per value (0..255)
+static inline void StoreColorChannelsSSE2(unsigned char *colors, __m128i r, __m128i g, __m128i b, __m128i a)
+{
+    __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+    __m128i ba = _mm_or_si128(b, _mm_slli_epi16(a, 8));
+
+    _mm_storeu_si128((__m128i *)colors, _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128((__m128i *)(colors + 16), _mm_unpackhi_epi16(rg, ba));
+}
+
+// Gray values of 4 RGBA pixels as 32-bit integers, the same float math as the plain C loops
+static inline __m128i GetGrayValuesSSE2(__m128i pixels)
+{
+    __m128i byteMask = _mm_set1_epi32(0xff);
+    __m128 scale = _mm_set1_ps(255.0f);
+
+    __m128 r = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(pixels, byteMask)), scale);
+    __m128 g = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 8), byteMask)), scale);
+    __m128 b = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 16), byteMask)), scale);
+    __m128 gray = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(0.299f)), _mm_mul_ps(g, _mm_set1_ps(0.587f))), _mm_mul_ps(b, _mm_set1_ps(0.114f)));
+
+    return _mm_cvttps_epi32(_mm_mul_ps(gray, scale));
+}
+#endif
+
+// Direct converter: GRAYSCALE to RGBA
+static void ConvertGrayToColors(const void *src, void *dst, int count)
+{
+    const unsigned char *gray = (const unsigned char *)src;
+    unsigned char *colors = (unsigned char *)dst;
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    __m128i alpha = _mm_set1_epi32((int)0xff000000);
+
+    // 16 pixels at a time: every gray byte repeated 4 times, alpha set
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i values = _mm_loadu_si128((const __m128i *)(gray + i));
+        __m128i low = _mm_unpacklo_epi8(values, values);
+        __m128i high = _mm_unpackhi_epi8(values, values);
+
+        _mm_storeu_si128((__m128i *)(colors + i*4), _mm_or_si128(_mm_unpacklo_epi16(low, low), alpha));
+        _mm_storeu_si128((__m128i *)(colors + i*4 + 16), _mm_or_si128(_mm_unpackhi_epi16(low, low), alpha));
+        _mm_storeu_si128((__m128i *)(colors + i*4 + 32), _mm_or_si128(_mm_unpacklo_epi16(high, high), alpha));
+        _mm_storeu_si128((__m128i *)(colors + i*4 + 48), _mm_or_si128(_mm_unpackhi_epi16(high, high), alpha));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        colors[i*4] = gray[i];
+        colors[i*4 + 1] = gray[i];
+        colors[i*4 + 2] = gray[i];
+        colors[i*4 + 3] = 255;
+    }
+}
+
+// Direct converter: GRAY_ALPHA to RGBA
+static void ConvertGrayAlphaToColors(const void *src, void *dst, int count)
+{
+    const unsigned char *pixels = (const unsigned char *)src;
+    unsigned char *colors = (unsigned char *)dst;
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    __m128i grayMask = _mm_set1_epi16(0xff);
+
+    // 8 pixels at a time: 16-bit (gray, gray) interleaved with 16-bit (gray, alpha)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i values = _mm_loadu_si128((const __m128i *)(pixels + i*2));
+        __m128i gray = _mm_and_si128(values, grayMask);
+        gray = _mm_or_si128(gray, _mm_slli_epi16(gray, 8));
+
+        _mm_storeu_si128((__m128i *)(colors + i*4), _mm_unpacklo_epi16(gray, values));
+        _mm_storeu_si128((__m128i *)(colors + i*4 + 16), _mm_unpackhi_epi16(gray, values));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        colors[i*4] = pixels[i*2];
+        colors[i*4 + 1] = pixels[i*2];
+        colors[i*4 + 2] = pixels[i*2];
+        colors[i*4 + 3] = pixels[i*2 + 1];
+    }
+}
+
+// Direct converter: R5G6B5 to RGBA
+// NOTE: value*255/31 (or /63) is what the float math gives, truncated like ImageFormat() does
+static void ConvertR5G6B5ToColors(const void *src, void *dst, int count)
+{
+    const unsigned short *pixels = (const unsigned short *)src;
+    unsigned char *colors = (unsigned char *)dst;
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    // 8 pixels at a time, 16bit per channel
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i values = _mm_loadu_si128((const __m128i *)(pixels + i));
+        __m128i r = ExpandChannelSSE2(_mm_srli_epi16(values, 11), 5);
+        __m128i g = ExpandChannelSSE2(_mm_and_si128(_mm_srli_epi16(values, 5), _mm_set1_epi16(0x3f)), 6);
+        __m128i b = ExpandChannelSSE2(_mm_and_si128(values, _mm_set1_epi16(0x1f)), 5);
+
+        StoreColorChannelsSSE2(colors + i*4, r, g, b, _mm_set1_epi16(255));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned int pixel = pixels[i];
+
+        colors[i*4] = (unsigned char)(((pixel >> 11) & 0x1f)*255/31);
+        colors[i*4 + 1] = (unsigned char)(((pixel >> 5) & 0x3f)*255/63);
+        colors[i*4 + 2] = (unsigned char)((pixel & 0x1f)*255/31);
+        colors[i*4 + 3] = 255;
+    }
+}
+
+// Direct converter: R8G8B8 to RGBA
+// NOTE: Every pixel but the last one is copied as 4 bytes, the 4th byte (next pixel red) replaced by alpha
+static void ConvertR8G8B8ToColors(const void *src, void *dst, int count)
+{
+    const unsigned char *pixels = (const unsigned char *)src;
+    unsigned char *colors = (unsigned char *)dst;
+    int i = 0;
+
+    for (; i < count - 1; i++)
+    {
+        memcpy(colors + i*4, pixels + i*3, 4);
+        colors[i*4 + 3] = 255;
+    }
+
+    if (i < count)
+    {
+        colors[i*4] = pixels[i*3];
+        colors[i*4 + 1] = pixels[i*3 + 1];
+        colors[i*4 + 2] = pixels[i*3 + 2];
+        colors[i*4 + 3] = 255;
+    }
+}
+
+// Direct converter: R5G5B5A1 to RGBA
+static void ConvertR5G5B5A1ToColors(const void *src, void *dst, int count)
+{
+    const unsigned short *pixels = (const unsigned short *)src;
+    unsigned char *colors = (unsigned char *)dst;
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i values = _mm_loadu_si128((const __m128i *)(pixels + i));
+        __m128i mask = _mm_set1_epi16(0x1f);
+        __m128i r = ExpandChannelSSE2(_mm_srli_epi16(values, 11), 5);
+        __m128i g = ExpandChannelSSE2(_mm_and_si128(_mm_srli_epi16(values, 6), mask), 5);
+        __m128i b = ExpandChannelSSE2(_mm_and_si128(_mm_srli_epi16(values, 1), mask), 5);
+        __m128i a = _mm_mullo_epi16(_mm_and_si128(values, _mm_set1_epi16(0x1)), _mm_set1_epi16(255));
+
+        StoreColorChannelsSSE2(colors + i*4, r, g, b, a);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned int pixel = pixels[i];
+
+        colors[i*4] = (unsigned char)(((pixel >> 11) & 0x1f)*255/31);
+        colors[i*4 + 1] = (unsigned char)(((pixel >> 6) & 0x1f)*255/31);
+        colors[i*4 + 2] = (unsigned char)(((pixel >> 1) & 0x1f)*255/31);
+        colors[i*4 + 3] = (unsigned char)((pixel & 0x1)*255);
+    }
+}
+
+// Direct converter: R4G4B4A4 to RGBA
+// NOTE: value*17 repeats the 4 bits in the high and low half of the byte
+static void ConvertR4G4B4A4ToColors(const void *src, void *dst, int count)
+{
+    const unsigned short *pixels = (const unsigned short *)src;
+    unsigned char *colors = (unsigned char *)dst;
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i values = _mm_loadu_si128((const __m128i *)(pixels + i));
+        __m128i mask = _mm_set1_epi16(0xf);
+        __m128i r = _mm_srli_epi16(values, 12);
+        __m128i g = _mm_and_si128(_mm_srli_epi16(values, 8), mask);
+        __m128i b = _mm_and_si128(_mm_srli_epi16(values, 4), mask);
+        __m128i a = _mm_and_si128(values, mask);
+
+        StoreColorChannelsSSE2(colors + i*4, _mm_or_si128(r, _mm_slli_epi16(r, 4)), _mm_or_si128(g, _mm_slli_epi16(g, 4)),
+            _mm_or_si128(b, _mm_slli_epi16(b, 4)), _mm_or_si128(a, _mm_slli_epi16(a, 4)));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned int pixel = pixels[i];
+
+        colors[i*4] = (unsigned char)(((pixel >> 12) & 0xf)*17);
+        colors[i*4 + 1] = (unsigned char)(((pixel >> 8) & 0xf)*17);
+        colors[i*4 + 2] = (unsigned char)(((pixel >> 4) & 0xf)*17);
+        colors[i*4 + 3] = (unsigned char)((pixel & 0xf)*17);
+    }
+}
+
+// Direct converter: RGBA to GRAYSCALE
+// NOTE: Every gray pixel is written at or before the pixel it is read from, so src and dst can be the same
+static void ConvertColorsToGray(const void *src, void *dst, int count)
+{
+    const unsigned char *colors = (const unsigned char *)src;
+    unsigned char *gray = (unsigned char *)dst;
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i low = _mm_packs_epi32(GetGrayValuesSSE2(_mm_loadu_si128((const __m128i *)(colors + i*4))),
+            GetGrayValuesSSE2(_mm_loadu_si128((const __m128i *)(colors + i*4 + 16))));
+        __m128i high = _mm_packs_epi32(GetGrayValuesSSE2(_mm_loadu_si128((const __m128i *)(colors + i*4 + 32))),
+            GetGrayValuesSSE2(_mm_loadu_si128((const __m128i *)(colors + i*4 + 48))));
+
+        _mm_storeu_si128((__m128i *)(gray + i), _mm_packus_epi16(low, high));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        gray[i] = (unsigned char)(((float)colors[i*4]/255.0f*0.299f + (float)colors[i*4 + 1]/255.0f*0.587f + (float)colors[i*4 + 2]/255.0f*0.114f)*255.0f);
+    }
+}
+
+// Direct converter: RGBA to GRAY_ALPHA
+static void ConvertColorsToGrayAlpha(const void *src, void *dst, int count)
+{
+    const unsigned char *colors = (const unsigned char *)src;
+    unsigned char *pixels = (unsigned char *)dst;
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i first = _mm_loadu_si128((const __m128i *)(colors + i*4));
+        __m128i second = _mm_loadu_si128((const __m128i *)(colors + i*4 + 16));
+        __m128i gray = _mm_packs_epi32(GetGrayValuesSSE2(first), GetGrayValuesSSE2(second));
+        __m128i alpha = _mm_packs_epi32(_mm_srli_epi32(first, 24), _mm_srli_epi32(second, 24));
+
+        _mm_storeu_si128((__m128i *)(pixels + i*2), _mm_unpacklo_epi8(_mm_packus_epi16(gray, gray), _mm_packus_epi16(alpha, alpha)));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        pixels[i*2] = (unsigned char)(((float)colors[i*4]/255.0f*0.299f + (float)colors[i*4 + 1]/255.0f*0.587f + (float)colors[i*4 + 2]/255.0f*0.114f)*255.0f);
+        pixels[i*2 + 1] = colors[i*4 + 3];
+    }
+}
+
+// Direct converter: RGBA to R5G6B5
+// NOTE: (value*31 + 127)/255 is round(value/255.0f*31.0f), an exact half never happens so it rounds the same way
+static void ConvertColorsToR5G6B5(const void *src, void *dst, int count)
+{
+    const unsigned char *colors = (const unsigned char *)src;
+    unsigned short *pixels = (unsigned short *)dst;
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i r, g, b, a;
+        LoadColorChannelsSSE2(colors + i*4, &r, &g, &b, &a);
+
+        __m128i values = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(ReduceChannelSSE2(r, 31), 11), _mm_slli_epi16(ReduceChannelSSE2(g, 63), 5)), ReduceChannelSSE2(b, 31));
+        _mm_storeu_si128((__m128i *)(pixels + i), values);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned int r = (colors[i*4]*31 + 127)/255;
+        unsigned int g = (colors[i*4 + 1]*63 + 127)/255;
+        unsigned int b = (colors[i*4 + 2]*31 + 127)/255;
+
+        pixels[i] = (unsigned short)(r << 11 | g << 5 | b);
+    }
+}
+
+// Direct converter: RGBA to R8G8B8
+// NOTE: Every pixel but the last one is copied as 4 bytes, the 4th byte is overwritten by the next pixel
+static void ConvertColorsToR8G8B8(const void *src, void *dst, int count)
+{
+    const unsigned char *colors = (const unsigned char *)src;
+    unsigned char *pixels = (unsigned char *)dst;
+    int i = 0;
+
+    for (; i < count - 1; i++) memcpy(pixels + i*3, colors + i*4, 4);
+
+    if (i < count)
+    {
+        pixels[i*3] = colors[i*4];
+        pixels[i*3 + 1] = colors[i*4 + 1];
+        pixels[i*3 + 2] = colors[i*4 + 2];
+    }
+}
+
+// Direct converter: RGBA to R5G5B5A1
+static void ConvertColorsToR5G5B5A1(const void *src, void *dst, int count)
+{
+    const unsigned char *colors = (const unsigned char *)src;
+    unsigned short *pixels = (unsigned short *)dst;
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i r, g, b, a;
+        LoadColorChannelsSSE2(colors + i*4, &r, &g, &b, &a);
+
+        a = _mm_srli_epi16(_mm_cmpgt_epi16(a, _mm_set1_epi16(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), 15);
+        __m128i values = _mm_or_si128(_mm_slli_epi16(ReduceChannelSSE2(r, 31), 11), _mm_slli_epi16(ReduceChannelSSE2(g, 31), 6));
+        values = _mm_or_si128(values, _mm_or_si128(_mm_slli_epi16(ReduceChannelSSE2(b, 31), 1), a));
+        _mm_storeu_si128((__m128i *)(pixels + i), values);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned int r = (colors[i*4]*31 + 127)/255;
+        unsigned int g = (colors[i*4 + 1]*31 + 127)/255;
+        unsigned int b = (colors[i*4 + 2]*31 + 127)/255;
+        unsigned int a = (colors[i*4 + 3] > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0;
+
+        pixels[i] = (unsigned short)(r << 11 | g << 6 | b << 1 | a);
+    }
+}
+
+// Direct converter: RGBA to R4G4B4A4
+static void ConvertColorsToR4G4B4A4(const void *src, void *dst, int count)
+{
+    const unsigned char *colors = (const unsigned char *)src;
+    unsigned short *pixels = (unsigned short *)dst;
+    int i = 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i r, g, b, a;
+        LoadColorChannelsSSE2(colors + i*4, &r, &g, &b, &a);
+
+        __m128i values = _mm_or_si128(_mm_slli_epi16(ReduceChannelSSE2(r, 15), 12), _mm_slli_epi16(ReduceChannelSSE2(g, 15), 8));
+        values = _mm_or_si128(values, _mm_or_si128(_mm_slli_epi16(ReduceChannelSSE2(b, 15), 4), ReduceChannelSSE2(a, 15)));
+        _mm_storeu_si128((__m128i *)(pixels + i), values);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned int r = (colors[i*4]*15 + 127)/255;
+        unsigned int g = (colors[i*4 + 1]*15 + 127)/255;
+        unsigned int b = (colors[i*4 + 2]*15 + 127)/255;
+        unsigned int a = (colors[i*4 + 3]*15 + 127)/255;
+
+        pixels[i] = (unsigned short)(r << 12 | g << 8 | b << 4 | a);
+    }
+}
+
+// Convert half-float (stored as unsigned short) to float
+// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
+static float HalfToFloat(unsigned short x)
+{
+    float result = 0.0f;
+
+    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
+    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
+    const float fm = (float)m;
+    const unsigned int v = (*(unsigned int*)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
+    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+
+    result = *(float *)&r;
+
+    return result;
+}
+
+// Convert float to half-float (stored as unsigned short)
+static unsigned short FloatToHalf(float x)
+{
+    unsigned short result = 0;
+
+    const unsigned int b = (*(unsigned int*) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
+    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
+    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+
+    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+
+    return result;
+}
+
+// Get pixel data from image as Vector4 array (float normalized)
+// NOTE: 8-bit channel values are looked up, same values as dividing them by 255.0f
+static Vector4 *LoadImageDataNormalized(Image image)
+{
+    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        float normalized[256] = { 0 };
+        for (int i = 0; i < 256; i++) normalized[i] = (float)i/255.0f;
+
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = normalized[((unsigned char *)image.data)[i]];
+                    pixels[i].y = normalized[((unsigned char *)image.data)[i]];
+                    pixels[i].z = normalized[((unsigned char *)image.data)[i]];
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = normalized[((unsigned char *)image.data)[k]];
+                    pixels[i].y = normalized[((unsigned char *)image.data)[k]];
+                    pixels[i].z = normalized[((unsigned char *)image.data)[k]];
+                    pixels[i].w = normalized[((unsigned char *)image.data)[k + 1]];
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+                } break;
                 case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
                 {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+                    pixels[i].x = normalized[((unsigned char *)image.data)[k]];
+                    pixels[i].y = normalized[((unsigned char *)image.data)[k + 1]];
+                    pixels[i].z = normalized[((unsigned char *)image.data)[k + 2]];
+                    pixels[i].w = normalized[((unsigned char *)image.data)[k + 3]];
 
                     k += 4;
                 } break;
                 case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
                 {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].x = normalized[((unsigned char *)image.data)[k]];
+                    pixels[i].y = normalized[((unsigned char *)image.data)[k + 1]];
+                    pixels[i].z = normalized[((unsigned char *)image.data)[k + 2]];
                     pixels[i].w = 1.0f;
 
                     k += 3;
@@ -5493,6 +7164,7 @@ static Vector4 *LoadImageDataNormalized(Image image)
                     pixels[i].z = 0.0f;
                     pixels[i].w = 1.0f;
 
+                    k += 1;
                 } break;
                 case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
                 {
@@ -5518,6 +7190,8 @@ static Vector4 *LoadImageDataNormalized(Image image)
                     pixels[i].y = 0.0f;
                     pixels[i].z = 0.0f;
                     pixels[i].w = 1.0f;
+
+                    k += 1;
                 } break;
                 case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
                 {
@@ -5545,4 +7219,1746 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Get number of pixels in image data, all mipmap levels included
+static int GetImagePixelCount(Image image)
+{
+    int count = 0;
+    int mipWidth = image.width;
+    int mipHeight = image.height;
+
+    for (int i = 0; i < image.mipmaps; i++)
+    {
+        count += mipWidth*mipHeight;
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
+
+    return count;
+}
+
+// Replace every color channel value by tables[channel][value] (channels: r, g, b, a)
+// NOTE: 8-bit per channel formats are modified in place (all mipmap levels), other formats are converted to RGBA and back
+static void ImageApplyColorTables(Image *image, unsigned char tables[4][256])
+{
+    unsigned char *data = (unsigned char *)image->data;
+    int count = GetImagePixelCount(*image);
+
+    switch (image->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // Gray values go through the r, g and b tables and come back as one gray value, like ImageFormat() would do
+            unsigned char gray[256] = { 0 };
+            bool sameTables = (memcmp(tables[0], tables[1], 256) == 0) && (memcmp(tables[0], tables[2], 256) == 0);
+
+            for (int i = 0; i < 256; i++)
+            {
+                if (sameTables) gray[i] = tables[0][i];
+                else gray[i] = (unsigned char)(((float)tables[0][i]/255.0f*0.299f + (float)tables[1][i]/255.0f*0.587f + (float)tables[2][i]/255.0f*0.114f)*255.0f);
+            }
+
+            if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) for (int i = 0; i < count; i++) data[i] = gray[data[i]];
+            else
+            {
+                for (int i = 0; i < count*2; i += 2)
+                {
+                    data[i] = gray[data[i]];
+                    data[i + 1] = tables[3][data[i + 1]];
+                }
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int i = 0; i < count*3; i += 3)
+            {
+                data[i] = tables[0][data[i]];
+                data[i + 1] = tables[1][data[i + 1]];
+                data[i + 2] = tables[2][data[i + 2]];
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            for (int i = 0; i < count*4; i += 4)
+            {
+                data[i] = tables[0][data[i]];
+                data[i + 1] = tables[1][data[i + 1]];
+                data[i + 2] = tables[2][data[i + 2]];
+                data[i + 3] = tables[3][data[i + 3]];
+            }
+        } break;
+        default:
+        {
+            Color *pixels = LoadImageColors(*image);
+
+            for (int i = 0; i < image->width*image->height; i++)
+            {
+                pixels[i].r = tables[0][pixels[i].r];
+                pixels[i].g = tables[1][pixels[i].g];
+                pixels[i].b = tables[2][pixels[i].b];
+                pixels[i].a = tables[3][pixels[i].a];
+            }
+
+            int format = image->format;
+            RL_FREE(image->data);
+
+            image->data = pixels;
+            image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+            ImageFormat(image, format);
+        } break;
+    }
+}
+
+// Replace image data by a RGBA pixels array (base level only), converted back to the image format
+// NOTE: Mipmaps are generated again from the new base level
+static void ImageSetColors(Image *image, Color *pixels)
+{
+    int format = image->format;
+    int mipmaps = image->mipmaps;
+
+    RL_FREE(image->data);
+    image->data = pixels;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image->mipmaps = 1;
+
+    ImageFormat(image, format);
+    if (mipmaps > 1) ImageMipmaps(image);
+}
+
+#if defined(RL_TEXTURES_SSE2)
+// Load one RGBA pixel into the low 32 bits of a SSE2 register
+static inline __m128i LoadPixelSSE2(const unsigned char *pixel)
+{
+    int value = 0;
+    memcpy(&value, pixel, 4);
+
+    return _mm_cvtsi32_si128(value);
+}
+
+// Store the low 32 bits of a SSE2 register as one RGBA pixel
+static inline void StorePixelSSE2(unsigned char *pixel, __m128i value)
+{
+    int result = _mm_cvtsi128_si32(value);
+    memcpy(pixel, &result, 4);
+}
+#endif
+
+// Premultiply alpha task: pixels [start, end) of dst, same math as ImageAlphaPremultiply()
+static void ImagePremultiplyPixels(void *data, int start, int end)
+{
+    Color *pixels = ((ImageFilterJob *)data)->dst;
+
+    for (int i = start; i < end; i++)
+    {
+        if (pixels[i].a == 0)
+        {
+            pixels[i].r = 0;
+            pixels[i].g = 0;
+            pixels[i].b = 0;
+        }
+        else if (pixels[i].a < 255)
+        {
+            float alpha = (float)pixels[i].a/255.0f;
+            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
+            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
+            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
+        }
+    }
+}
+
+// Reverse premultiplied alpha task: pixels [start, end) of dst
+static void ImageUnpremultiplyPixels(void *data, int start, int end)
+{
+    Color *pixels = ((ImageFilterJob *)data)->dst;
+
+    for (int i = start; i < end; i++)
+    {
+        if (pixels[i].a == 0)
+        {
+            pixels[i].r = 0;
+            pixels[i].g = 0;
+            pixels[i].b = 0;
+        }
+        else if (pixels[i].a < 255)
+        {
+            float alpha = (float)pixels[i].a/255.0f;
+            pixels[i].r = (unsigned char)fminf((float)pixels[i].r/alpha, 255.0f);
+            pixels[i].g = (unsigned char)fminf((float)pixels[i].g/alpha, 255.0f);
+            pixels[i].b = (unsigned char)fminf((float)pixels[i].b/alpha, 255.0f);
+        }
+    }
+}
+
+// Box blur task, horizontal pass: rows [start, end) of src into dst
+// NOTE: Channels are summed as integers, the window average is rounded to 8 bit
+static void ImageBlurBoxRows(void *data, int start, int end)
+{
+    ImageFilterJob *job = (ImageFilterJob *)data;
+    int width = job->width;
+    int radius = job->radius;
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *src = (const unsigned char *)(job->src + y*width);
+        unsigned char *dst = (unsigned char *)(job->dst + y*width);
+
+    #if defined(RL_TEXTURES_SSE2)
+        __m128i zero = _mm_setzero_si128();
+        __m128 half = _mm_set1_ps(0.5f);    // Round to nearest, the same way as the plain C loop
+        __m128i sum = zero;     // r, g, b, a sums of the pixels in the window
+
+        #define RL_LOAD_PIXEL_EPI32(p) _mm_unpacklo_epi16(_mm_unpacklo_epi8(LoadPixelSSE2(p), zero), zero)
+
+        for (int x = 0; (x < radius) && (x < width); x++) sum = _mm_add_epi32(sum, RL_LOAD_PIXEL_EPI32(src + x*4));
+
+        for (int x = 0; x < width; x++)
+        {
+            if (x + radius < width) sum = _mm_add_epi32(sum, RL_LOAD_PIXEL_EPI32(src + (x + radius)*4));
+            if (x - radius - 1 >= 0) sum = _mm_sub_epi32(sum, RL_LOAD_PIXEL_EPI32(src + (x - radius - 1)*4));
+
+            __m128i average = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum), _mm_set1_ps(job->scales[x])), half));
+            average = _mm_packs_epi32(average, average);
+            StorePixelSSE2(dst + x*4, _mm_packus_epi16(average, average));
+        }
+
+        #undef RL_LOAD_PIXEL_EPI32
+    #else
+        int sum[4] = { 0 };     // r, g, b, a sums of the pixels in the window
+
+        for (int x = 0; (x < radius) && (x < width); x++) for (int c = 0; c < 4; c++) sum[c] += src[x*4 + c];
+
+        for (int x = 0; x < width; x++)
+        {
+            if (x + radius < width) for (int c = 0; c < 4; c++) sum[c] += src[(x + radius)*4 + c];
+            if (x - radius - 1 >= 0) for (int c = 0; c < 4; c++) sum[c] -= src[(x - radius - 1)*4 + c];
+
+            for (int c = 0; c < 4; c++) dst[x*4 + c] = (unsigned char)((float)sum[c]*job->scales[x] + 0.5f);
+        }
+    #endif
+    }
+}
+
+// Box blur task, vertical pass: columns [start, end) of src into dst
+// NOTE: Walks down the image row by row keeping a running sum per column, so memory is read in order
+static void ImageBlurBoxColumns(void *data, int start, int end)
+{
+    ImageFilterJob *job = (ImageFilterJob *)data;
+    int width = job->width;
+    int height = job->height;
+    int radius = job->radius;
+    int size = (end - start)*4;     // Channels in the band
+
+    int *sums = (int *)RL_CALLOC(size, sizeof(int));
+
+    for (int y = 0; (y < radius) && (y < height); y++)
+    {
+        const unsigned char *src = (const unsigned char *)(job->src + y*width + start);
+        for (int i = 0; i < size; i++) sums[i] += src[i];
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *add = (y + radius < height)? (const unsigned char *)(job->src + (y + radius)*width + start) : NULL;
+        const unsigned char *remove = (y - radius - 1 >= 0)? (const unsigned char *)(job->src + (y - radius - 1)*width + start) : NULL;
+        unsigned char *dst = (unsigned char *)(job->dst + y*width + start);
+        float scale = job->scales[y];
+        int i = 0;
+
+    #if defined(RL_TEXTURES_SSE2)
+        __m128i zero = _mm_setzero_si128();
+        __m128 scales = _mm_set1_ps(scale);
+        __m128 half = _mm_set1_ps(0.5f);    // Round to nearest, the same way as the plain C loop
+
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i sum0 = _mm_loadu_si128((__m128i *)(sums + i));
+            __m128i sum1 = _mm_loadu_si128((__m128i *)(sums + i + 4));
+            __m128i sum2 = _mm_loadu_si128((__m128i *)(sums + i + 8));
+            __m128i sum3 = _mm_loadu_si128((__m128i *)(sums + i + 12));
+
+            if (add != NULL)
+            {
+                __m128i pixels = _mm_loadu_si128((const __m128i *)(add + i));
+                __m128i low = _mm_unpacklo_epi8(pixels, zero);
+                __m128i high = _mm_unpackhi_epi8(pixels, zero);
+                sum0 = _mm_add_epi32(sum0, _mm_unpacklo_epi16(low, zero));
+                sum1 = _mm_add_epi32(sum1, _mm_unpackhi_epi16(low, zero));
+                sum2 = _mm_add_epi32(sum2, _mm_unpacklo_epi16(high, zero));
+                sum3 = _mm_add_epi32(sum3, _mm_unpackhi_epi16(high, zero));
+            }
+
+            if (remove != NULL)
+            {
+                __m128i pixels = _mm_loadu_si128((const __m128i *)(remove + i));
+                __m128i low = _mm_unpacklo_epi8(pixels, zero);
+                __m128i high = _mm_unpackhi_epi8(pixels, zero);
+                sum0 = _mm_sub_epi32(sum0, _mm_unpacklo_epi16(low, zero));
+                sum1 = _mm_sub_epi32(sum1, _mm_unpackhi_epi16(low, zero));
+                sum2 = _mm_sub_epi32(sum2, _mm_unpacklo_epi16(high, zero));
+                sum3 = _mm_sub_epi32(sum3, _mm_unpackhi_epi16(high, zero));
+            }
+
+            _mm_storeu_si128((__m128i *)(sums + i), sum0);
+            _mm_storeu_si128((__m128i *)(sums + i + 4), sum1);
+            _mm_storeu_si128((__m128i *)(sums + i + 8), sum2);
+            _mm_storeu_si128((__m128i *)(sums + i + 12), sum3);
+
+            __m128i low = _mm_packs_epi32(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum0), scales), half)), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum1), scales), half)));
+            __m128i high = _mm_packs_epi32(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum2), scales), half)), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum3), scales), half)));
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(low, high));
+        }
+    #endif
+        for (; i < size; i++)
+        {
+            if (add != NULL) sums[i] += add[i];
+            if (remove != NULL) sums[i] -= remove[i];
+
+            dst[i] = (unsigned char)((float)sums[i]*scale + 0.5f);
+        }
+    }
+
+    RL_FREE(sums);
+}
+
+// Check if a square kernel is a column vector times a row vector, so it can be applied in two 1D passes
+// NOTE: kernel[i*kernelWidth + j] = columnWeights[i]*rowWeights[j], i being the row
+static bool IsKernelSeparable(const float *kernel, int kernelWidth, float *columnWeights, float *rowWeights)
+{
+    int pivot = 0;
+    float maxWeight = 0.0f;
+
+    for (int i = 0; i < kernelWidth*kernelWidth; i++)
+    {
+        if (fabsf(kernel[i]) > maxWeight)
+        {
+            maxWeight = fabsf(kernel[i]);
+            pivot = i;
+        }
+    }
+
+    if (maxWeight == 0.0f) return false;
+
+    int pivotRow = pivot/kernelWidth;
+    int pivotColumn = pivot%kernelWidth;
+
+    for (int i = 0; i < kernelWidth; i++)
+    {
+        columnWeights[i] = kernel[i*kernelWidth + pivotColumn];
+        rowWeights[i] = kernel[pivotRow*kernelWidth + i]/kernel[pivot];
+    }
+
+    for (int i = 0; i < kernelWidth; i++)
+    {
+        for (int j = 0; j < kernelWidth; j++)
+        {
+            if (fabsf(kernel[i*kernelWidth + j] - columnWeights[i]*rowWeights[j]) > maxWeight*1e-5f) return false;
+        }
+    }
+
+    return true;
+}
+
+// Separable convolution task: rows [start, end) of src into dst, out of image pixels count as 0
+// NOTE: Works in bands of rows, the horizontal pass of a band (plus the rows the kernel reaches
+// above and below) is kept as floats in a small buffer the vertical pass reads from
+static void ImageConvolveSeparableRows(void *data, int start, int end)
+{
+    ImageFilterJob *job = (ImageFilterJob *)data;
+    int width = job->width;
+    int height = job->height;
+    int kernelWidth = job->kernelWidth;
+    int half = kernelWidth/2;
+    const int bandSize = 32;
+
+    float *line = (float *)RL_MALLOC(width*4*sizeof(float));                                 // Source row as floats
+    float *band = (float *)RL_MALLOC((bandSize + kernelWidth - 1)*width*4*sizeof(float));   // Horizontal pass rows
+
+    for (int bandStart = start; bandStart < end; bandStart += bandSize)
+    {
+        int bandEnd = (bandStart + bandSize < end)? bandStart + bandSize : end;
+        int firstRow = bandStart - half;
+        int rowCount = bandEnd - bandStart + kernelWidth - 1;
+
+        // Horizontal pass
+        for (int r = 0; r < rowCount; r++)
+        {
+            float *out = band + r*width*4;
+            int y = firstRow + r;
+
+            if ((y < 0) || (y >= height))
+            {
+                memset(out, 0, width*4*sizeof(float));
+                continue;
+            }
+
+            const unsigned char *src = (const unsigned char *)(job->src + y*width);
+            for (int i = 0; i < width*4; i++) line[i] = (float)src[i];
+
+            for (int x = 0; x < width; x++)
+            {
+                int first = (x - half < 0)? half - x : 0;                                   // First tap inside the image
+                int last = (x - half + kernelWidth > width)? width - x + half : kernelWidth;    // One past the last tap inside
+
+            #if defined(RL_TEXTURES_SSE2)
+                __m128 sum = _mm_setzero_ps();
+                for (int k = first; k < last; k++) sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(line + (x - half + k)*4), _mm_set1_ps(job->rowWeights[k])));
+                _mm_storeu_ps(out + x*4, sum);
+            #else
+                float sum[4] = { 0 };
+                for (int k = first; k < last; k++) for (int c = 0; c < 4; c++) sum[c] += line[(x - half + k)*4 + c]*job->rowWeights[k];
+                for (int c = 0; c < 4; c++) out[x*4 + c] = sum[c];
+            #endif
+            }
+        }
+
+        // Vertical pass
+        for (int y = bandStart; y < bandEnd; y++)
+        {
+            const float *in = band + (y - bandStart)*width*4;
+            unsigned char *dst = (unsigned char *)(job->dst + y*width);
+            int i = 0;
+
+        #if defined(RL_TEXTURES_SSE2)
+            for (; i + 4 <= width*4; i += 4)
+            {
+                __m128 sum = _mm_setzero_ps();
+                for (int k = 0; k < kernelWidth; k++) sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(in + k*width*4 + i), _mm_set1_ps(job->columnWeights[k])));
+
+                __m128i value = _mm_cvttps_epi32(_mm_add_ps(_mm_min_ps(_mm_max_ps(sum, _mm_setzero_ps()), _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+                value = _mm_packs_epi32(value, value);
+                StorePixelSSE2(dst + i, _mm_packus_epi16(value, value));
+            }
+        #endif
+            for (; i < width*4; i++)
+            {
+                float sum = 0.0f;
+                for (int k = 0; k < kernelWidth; k++) sum += in[k*width*4 + i]*job->columnWeights[k];
+
+                if (sum < 0.0f) sum = 0.0f;
+                if (sum > 255.0f) sum = 255.0f;
+                dst[i] = (unsigned char)(sum + 0.5f);
+            }
+        }
+    }
+
+    RL_FREE(line);
+    RL_FREE(band);
+}
+
+// Convolution task: rows [start, end) of src into dst, out of image pixels count as 0
+// NOTE: Weights are fixed point integers, pixels inside the image by a kernel radius are done two taps at a time with SSE2
+static void ImageConvolveRows(void *data, int start, int end)
+{
+    ImageFilterJob *job = (ImageFilterJob *)data;
+    int width = job->width;
+    int height = job->height;
+    int kernelWidth = job->kernelWidth;
+    int half = kernelWidth/2;
+    int rounding = (job->fixedShift > 0)? 1 << (job->fixedShift - 1) : 0;
+
+#if defined(RL_TEXTURES_SSE2)
+    // Weights of taps j and j + 1 of every kernel row, for _mm_madd_epi16() on pixels interleaved as r0 r1 g0 g1 b0 b1 a0 a1
+    int pairCount = (kernelWidth + 1)/2;
+    __m128i *pairs = (__m128i *)RL_MALLOC(kernelWidth*pairCount*sizeof(__m128i));
+
+    for (int i = 0; i < kernelWidth; i++)
+    {
+        for (int p = 0; p < pairCount; p++)
+        {
+            int first = job->fixedWeights[i*kernelWidth + p*2];
+            int second = (p*2 + 1 < kernelWidth)? job->fixedWeights[i*kernelWidth + p*2 + 1] : 0;
+            pairs[i*pairCount + p] = _mm_set1_epi32((int)(((unsigned int)second << 16) | ((unsigned int)first & 0xffff)));
+        }
+    }
+
+    __m128i zero = _mm_setzero_si128();
+#endif
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *dst = (unsigned char *)(job->dst + y*width);
+    #if defined(RL_TEXTURES_SSE2)
+        bool innerRow = (y - half >= 0) && (y - half + kernelWidth <= height);
+    #endif
+
+        for (int x = 0; x < width; x++)
+        {
+            int sum[4] = { rounding, rounding, rounding, rounding };
+
+        #if defined(RL_TEXTURES_SSE2)
+            if (innerRow && (x - half >= 0) && (x - half + kernelWidth <= width))
+            {
+                __m128i sums = _mm_set1_epi32(rounding);
+
+                for (int i = 0; i < kernelWidth; i++)
+                {
+                    const unsigned char *src = (const unsigned char *)(job->src + (y - half + i)*width + x - half);
+                    int j = 0;
+
+                    for (; j + 2 <= kernelWidth; j += 2)
+                    {
+                        __m128i pixels = _mm_loadl_epi64((const __m128i *)(src + j*4));
+                        pixels = _mm_unpacklo_epi8(_mm_unpacklo_epi8(pixels, _mm_srli_si128(pixels, 4)), zero);
+                        sums = _mm_add_epi32(sums, _mm_madd_epi16(pixels, pairs[i*pairCount + j/2]));
+                    }
+
+                    if (j < kernelWidth)
+                    {
+                        __m128i pixel = LoadPixelSSE2(src + j*4);
+                        pixel = _mm_unpacklo_epi8(_mm_unpacklo_epi8(pixel, zero), zero);
+                        sums = _mm_add_epi32(sums, _mm_madd_epi16(pixel, pairs[i*pairCount + j/2]));
+                    }
+                }
+
+                __m128i value = _mm_srai_epi32(sums, job->fixedShift);
+                value = _mm_packs_epi32(value, value);
+                StorePixelSSE2(dst + x*4, _mm_packus_epi16(value, value));
+                continue;
+            }
+        #endif
+            for (int i = 0; i < kernelWidth; i++)
+            {
+                int sy = y - half + i;
+                if ((sy < 0) || (sy >= height)) continue;
+
+                for (int j = 0; j < kernelWidth; j++)
+                {
+                    int sx = x - half + j;
+                    if ((sx < 0) || (sx >= width)) continue;
+
+                    const unsigned char *src = (const unsigned char *)(job->src + sy*width + sx);
+                    int weight = job->fixedWeights[i*kernelWidth + j];
+                    for (int c = 0; c < 4; c++) sum[c] += src[c]*weight;
+                }
+            }
+
+            for (int c = 0; c < 4; c++)
+            {
+                int value = sum[c] >> job->fixedShift;
+                dst[x*4 + c] = (unsigned char)((value < 0)? 0 : ((value > 255)? 255 : value));
+            }
+        }
+    }
+
+#if defined(RL_TEXTURES_SSE2)
+    RL_FREE(pairs);
+#endif
+}
+
+// Get lookup tables (r, g, b, a) for a tint, invert, contrast or brightness operation
+static void GetColorOperationTables(ImageOperation operation, unsigned char tables[4][256])
+{
+    switch (operation.type)
+    {
+        case IMAGE_OPERATION_COLOR_TINT:
+        {
+            Color color = operation.color;
+
+            for (int i = 0; i < 256; i++)
+            {
+                tables[0][i] = (unsigned char)((i*(int)color.r)/255);
+                tables[1][i] = (unsigned char)((i*(int)color.g)/255);
+                tables[2][i] = (unsigned char)((i*(int)color.b)/255);
+                tables[3][i] = (unsigned char)((i*(int)color.a)/255);
+            }
+        } break;
+        case IMAGE_OPERATION_COLOR_INVERT:
+        {
+            for (int i = 0; i < 256; i++)
+            {
+                tables[0][i] = tables[1][i] = tables[2][i] = (unsigned char)(255 - i);
+                tables[3][i] = (unsigned char)i;
+            }
+        } break;
+        case IMAGE_OPERATION_COLOR_CONTRAST:
+        {
+            float contrast = operation.value;
+
+            if (contrast < -100) contrast = -100;
+            if (contrast > 100) contrast = 100;
+
+            contrast = (100.0f + contrast)/100.0f;
+            contrast *= contrast;
+
+            for (int i = 0; i < 256; i++)
+            {
+                float value = (float)i/255.0f;
+                value -= 0.5f;
+                value *= contrast;
+                value += 0.5f;
+                value *= 255;
+                if (value < 0) value = 0;
+                if (value > 255) value = 255;
+
+                tables[0][i] = tables[1][i] = tables[2][i] = (unsigned char)value;
+                tables[3][i] = (unsigned char)i;
+            }
+        } break;
+        case IMAGE_OPERATION_COLOR_BRIGHTNESS:
+        {
+            int brightness = (int)operation.value;
+
+            if (brightness < -255) brightness = -255;
+            if (brightness > 255) brightness = 255;
+
+            for (int i = 0; i < 256; i++)
+            {
+                int value = i + brightness;
+
+                if (value < 0) value = 1;
+                if (value > 255) value = 255;
+
+                tables[0][i] = tables[1][i] = tables[2][i] = (unsigned char)value;
+                tables[3][i] = (unsigned char)i;
+            }
+        } break;
+        default:
+        {
+            for (int i = 0; i < 256; i++) tables[0][i] = tables[1][i] = tables[2][i] = tables[3][i] = (unsigned char)i;
+        } break;
+    }
+}
+
+// Record an operation at the end of an image pipeline
+static void AddImagePipelineOperation(ImagePipeline *pipeline, ImageOperation operation)
+{
+    ImageOperation *operations = (ImageOperation *)RL_REALLOC(pipeline->operations, (pipeline->operationCount + 1)*sizeof(ImageOperation));
+
+    if (operations == NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Pipeline operation could not be recorded");
+        return;
+    }
+
+    operations[pipeline->operationCount] = operation;
+    pipeline->operations = operations;
+    pipeline->operationCount++;
+}
+
+// Compile point operations into steps (resize and mipmaps operations are skipped), returns steps count
+// NOTE 1: steps must have room for count steps
+// NOTE 2: Without alpha (image format has no alpha channel) alpha is kept opaque, like the image would keep it
+static int CompileImagePipelineSteps(const ImageOperation *operations, int count, bool alpha, ImagePipelineStep *steps)
+{
+    int stepCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        switch (operations[i].type)
+        {
+            case IMAGE_OPERATION_COLOR_TINT:
+            case IMAGE_OPERATION_COLOR_INVERT:
+            case IMAGE_OPERATION_COLOR_CONTRAST:
+            case IMAGE_OPERATION_COLOR_BRIGHTNESS:
+            {
+                unsigned char tables[4][256] = { 0 };
+                GetColorOperationTables(operations[i], tables);
+                if (!alpha) for (int v = 0; v < 256; v++) tables[3][v] = (unsigned char)v;
+
+                ImagePipelineStep *previous = (stepCount > 0)? &steps[stepCount - 1] : NULL;
+
+                if ((previous != NULL) && ((previous->type == IMAGE_OPERATION_COLOR_TINT) || (previous->type == IMAGE_OPERATION_COLOR_INVERT) ||
+                    (previous->type == IMAGE_OPERATION_COLOR_CONTRAST) || (previous->type == IMAGE_OPERATION_COLOR_BRIGHTNESS)))
+                {
+                    // Fold into the previous tables: value goes through the previous table, then this one
+                    for (int c = 0; c < 4; c++)
+                    {
+                        for (int v = 0; v < 256; v++) previous->tables[c][v] = tables[c][previous->tables[c][v]];
+                    }
+                }
+                else
+                {
+                    ImagePipelineStep *step = &steps[stepCount++];
+                    step->type = operations[i].type;
+                    memcpy(step->tables, tables, sizeof(tables));
+                }
+            } break;
+            case IMAGE_OPERATION_COLOR_GRAYSCALE:
+            case IMAGE_OPERATION_COLOR_REPLACE:
+            case IMAGE_OPERATION_ALPHA_PREMULTIPLY:
+            {
+                ImagePipelineStep *step = &steps[stepCount++];
+                step->type = operations[i].type;
+                step->color = operations[i].color;
+                step->replace = operations[i].replace;
+                if (!alpha) step->replace.a = 255;
+            } break;
+            default: break;
+        }
+    }
+
+    return stepCount;
+}
+
+// Apply steps to RGBA pixels, in blocks of IMAGE_PIPELINE_BLOCK_SIZE pixels
+// NOTE: Same math as ImageColorGrayscale(), ImageColorReplace() and ImageAlphaPremultiply()
+static void ApplyImagePipelineSteps(const ImagePipelineStep *steps, int stepCount, unsigned char *pixels, int count)
+{
+    for (int block = 0; block < count; block += IMAGE_PIPELINE_BLOCK_SIZE)
+    {
+        unsigned char *data = pixels + block*4;
+        int size = ((count - block) < IMAGE_PIPELINE_BLOCK_SIZE)? (count - block)*4 : IMAGE_PIPELINE_BLOCK_SIZE*4;
+
+        for (int s = 0; s < stepCount; s++)
+        {
+            const ImagePipelineStep *step = &steps[s];
+
+            switch (step->type)
+            {
+                case IMAGE_OPERATION_COLOR_TINT:
+                case IMAGE_OPERATION_COLOR_INVERT:
+                case IMAGE_OPERATION_COLOR_CONTRAST:
+                case IMAGE_OPERATION_COLOR_BRIGHTNESS:
+                {
+                    for (int i = 0; i < size; i += 4)
+                    {
+                        data[i] = step->tables[0][data[i]];
+                        data[i + 1] = step->tables[1][data[i + 1]];
+                        data[i + 2] = step->tables[2][data[i + 2]];
+                        data[i + 3] = step->tables[3][data[i + 3]];
+                    }
+                } break;
+                case IMAGE_OPERATION_COLOR_GRAYSCALE:
+                {
+                    for (int i = 0; i < size; i += 4)
+                    {
+                        unsigned char gray = (unsigned char)(((float)data[i]/255.0f*0.299f + (float)data[i + 1]/255.0f*0.587f + (float)data[i + 2]/255.0f*0.114f)*255.0f);
+                        data[i] = data[i + 1] = data[i + 2] = gray;
+                    }
+                } break;
+                case IMAGE_OPERATION_COLOR_REPLACE:
+                {
+                    for (int i = 0; i < size; i += 4)
+                    {
+                        if (memcmp(data + i, &step->color, 4) == 0) memcpy(data + i, &step->replace, 4);
+                    }
+                } break;
+                case IMAGE_OPERATION_ALPHA_PREMULTIPLY:
+                {
+                    for (int i = 0; i < size; i += 4)
+                    {
+                        if (data[i + 3] == 0) data[i] = data[i + 1] = data[i + 2] = 0;
+                        else if (data[i + 3] < 255)
+                        {
+                            float alpha = (float)data[i + 3]/255.0f;
+                            data[i] = (unsigned char)((float)data[i]*alpha);
+                            data[i + 1] = (unsigned char)((float)data[i + 1]*alpha);
+                            data[i + 2] = (unsigned char)((float)data[i + 2]*alpha);
+                        }
+                    }
+                } break;
+                default: break;
+            }
+        }
+    }
+}
+
+// Apply image pipeline operations one by one with the Image*() functions, for formats the fused passes can't match
+// NOTE: Grayscale keeps alpha and image format (unlike ImageColorGrayscale()) and mipmaps are generated last, like the fused passes do
+static void ApplyImagePipelineOperations(Image *image, const ImageOperation *operations, int count)
+{
+    // Base level only as input
+    if (image->mipmaps > 1)
+    {
+        void *base = RL_REALLOC(image->data, GetPixelDataSize(image->width, image->height, image->format));
+        if (base != NULL) image->data = base;
+        image->mipmaps = 1;
+    }
+
+    bool mipmaps = false;
+
+    for (int i = 0; i < count; i++)
+    {
+        const ImageOperation *operation = &operations[i];
+
+        switch (operation->type)
+        {
+            case IMAGE_OPERATION_RESIZE: ImageResize(image, operation->width, operation->height); break;
+            case IMAGE_OPERATION_RESIZE_NN: ImageResizeNN(image, operation->width, operation->height); break;
+            case IMAGE_OPERATION_COLOR_TINT: ImageColorTint(image, operation->color); break;
+            case IMAGE_OPERATION_COLOR_INVERT: ImageColorInvert(image); break;
+            case IMAGE_OPERATION_COLOR_CONTRAST: ImageColorContrast(image, operation->value); break;
+            case IMAGE_OPERATION_COLOR_BRIGHTNESS: ImageColorBrightness(image, (int)operation->value); break;
+            case IMAGE_OPERATION_COLOR_REPLACE: ImageColorReplace(image, operation->color, operation->replace); break;
+            case IMAGE_OPERATION_ALPHA_PREMULTIPLY: ImageAlphaPremultiply(image); break;
+            case IMAGE_OPERATION_COLOR_GRAYSCALE:
+            {
+                Color *pixels = LoadImageColors(*image);
+                if (pixels == NULL) break;
+
+                ImagePipelineStep step = { 0 };
+                step.type = IMAGE_OPERATION_COLOR_GRAYSCALE;
+                ApplyImagePipelineSteps(&step, 1, (unsigned char *)pixels, image->width*image->height);
+
+                int format = image->format;
+                RL_FREE(image->data);
+                image->data = pixels;
+                image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+                ImageFormat(image, format);
+            } break;
+            case IMAGE_OPERATION_MIPMAPS: mipmaps = true; break;
+            default: break;
+        }
+    }
+
+    if (mipmaps) ImageMipmaps(image);
+}
+
+// Image pipeline task, no resize: rows [start, end) converted (or copied) to RGBA with all steps applied
+static void ImagePipelineRows(void *data, int start, int end)
+{
+    ImagePipelineJob *job = (ImagePipelineJob *)data;
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *src = job->src + (size_t)y*job->srcWidth*job->srcBytesPerPixel;
+        unsigned char *dst = job->dst + (size_t)y*job->dstWidth*4;
+
+        if (job->srcFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ConvertPixelsToColors(src, job->srcFormat, job->srcWidth, (Color *)dst);
+        else if (src != dst) memcpy(dst, src, job->srcWidth*4);
+
+        ApplyImagePipelineSteps(job->inputSteps, job->inputStepCount, dst, job->dstWidth);
+        ApplyImagePipelineSteps(job->outputSteps, job->outputStepCount, dst, job->dstWidth);
+    }
+}
+
+// Image pipeline task, Nearest-Neighbor resize: destination rows [start, end)
+// NOTE: Same sampling as ImageResizeNN(), point operations don't depend on neighbours so they are all applied after sampling
+static void ImagePipelineRowsNN(void *data, int start, int end)
+{
+    ImagePipelineJob *job = (ImagePipelineJob *)data;
+
+    // EDIT: added +1 to account for an early rounding problem
+    int xRatio = (int)((job->srcWidth << 16)/job->dstWidth) + 1;
+    int yRatio = (int)((job->srcHeight << 16)/job->dstHeight) + 1;
+
+    // Source rows in other formats are converted once to RGBA
+    Color *row = NULL;
+    int rowY = -1;
+    if (job->srcFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) row = (Color *)RL_MALLOC(job->srcWidth*sizeof(Color));
+
+    for (int y = start; y < end; y++)
+    {
+        int y2 = ((y*yRatio) >> 16);
+        const unsigned char *src = job->src + (size_t)y2*job->srcWidth*job->srcBytesPerPixel;
+        unsigned char *dst = job->dst + (size_t)y*job->dstWidth*4;
+
+        if (row != NULL)
+        {
+            if (rowY != y2) ConvertPixelsToColors(src, job->srcFormat, job->srcWidth, row);
+            rowY = y2;
+            src = (const unsigned char *)row;
+        }
+
+        for (int x = 0; x < job->dstWidth; x++) memcpy(dst + x*4, src + ((x*xRatio) >> 16)*4, 4);
+
+        ApplyImagePipelineSteps(job->inputSteps, job->inputStepCount, dst, job->dstWidth);
+        ApplyImagePipelineSteps(job->outputSteps, job->outputStepCount, dst, job->dstWidth);
+    }
+
+    RL_FREE(row);
+}
+
+// Image pipeline task, bicubic resize: stb resizer splits [start, end)
+static void ImagePipelineResizeSplits(void *data, int start, int end)
+{
+    ImagePipelineJob *job = (ImagePipelineJob *)data;
+
+    for (int i = start; i < end; i++) stbir_resize_extended_split(job->resize, i, 1);
+}
+
+// Bicubic resize source scanline callback: source pixels converted to RGBA, with the input steps applied
+static const void *ImagePipelineInputCallback(void *optionalOutput, const void *inputPtr, int count, int x, int y, void *context)
+{
+    ImagePipelineJob *job = (ImagePipelineJob *)context;
+    const unsigned char *src = job->src + ((size_t)y*job->srcWidth + x)*job->srcBytesPerPixel;
+    unsigned char *pixels = (unsigned char *)optionalOutput;
+
+    if (job->srcFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ConvertPixelsToColors(src, job->srcFormat, count, (Color *)pixels);
+    else if (job->inputStepCount > 0) memcpy(pixels, inputPtr, count*4);
+    else return inputPtr;
+
+    ApplyImagePipelineSteps(job->inputSteps, job->inputStepCount, pixels, count);
+
+    return pixels;
+}
+
+// Bicubic resize destination scanline callback: resized pixels stored with the output steps applied
+static void ImagePipelineOutputCallback(const void *outputPtr, int count, int y, void *context)
+{
+    ImagePipelineJob *job = (ImagePipelineJob *)context;
+    unsigned char *dst = job->dst + (size_t)y*job->dstWidth*4;
+
+    memcpy(dst, outputPtr, count*4);
+    ApplyImagePipelineSteps(job->outputSteps, job->outputStepCount, dst, count);
+}
+
+// Generate levels [first, count) of a mip chain with 8-bit channels, every level a 2x2 box filter of the previous one
+// NOTE: Levels are generated in rounds of log2(IMAGE_MIPMAP_STRIPE_ROWS) levels, every round split in stripes across threads.
+// A stripe takes its rows down through all the levels of the round while they are still in cache
+static void GenImageMipmapLevels(unsigned char *data, int width, int height, int channels, int first, int count, bool srgb)
+{
+    ImageMipmapJob job = { 0 };
+    job.channels = channels;
+    job.alphaChannel = (channels == 2)? 1 : ((channels == 4)? 3 : -1);
+
+    for (int i = 0; i < count; i++)
+    {
+        job.levels[i] = data;
+        job.widths[i] = width;
+        job.heights[i] = height;
+
+        data += (size_t)width*height*channels;
+        if (width != 1) width /= 2;
+        if (height != 1) height /= 2;
+    }
+
+    // sRGB lookup tables, linear values scaled to 14 bit, the table back to sRGB takes the sum of four of them
+    unsigned short *toLinear = NULL;
+    unsigned char *fromLinear = NULL;
+
+    if (srgb)
+    {
+        toLinear = (unsigned short *)RL_MALLOC(256*sizeof(unsigned short));
+        fromLinear = (unsigned char *)RL_MALLOC(4*16383 + 1);
+
+        for (int i = 0; i < 256; i++)
+        {
+            float value = (float)i/255.0f;
+            value = (value <= 0.04045f)? value/12.92f : powf((value + 0.055f)/1.055f, 2.4f);
+            toLinear[i] = (unsigned short)(value*16383.0f + 0.5f);
+        }
+
+        // Every 8-bit value takes the linear values up to the middle point between it and the next one
+        int linear = 0;
+
+        for (int i = 0; i < 255; i++)
+        {
+            float middle = ((float)i + 0.5f)/255.0f;
+            middle = (middle <= 0.04045f)? middle/12.92f : powf((middle + 0.055f)/1.055f, 2.4f);
+
+            while ((linear <= 4*16383) && ((float)linear < middle*4*16383.0f)) fromLinear[linear++] = (unsigned char)i;
+        }
+
+        while (linear <= 4*16383) fromLinear[linear++] = 255;
+
+        job.toLinear = toLinear;
+        job.fromLinear = fromLinear;
+    }
+
+    int roundLevels = 0;
+    while ((IMAGE_MIPMAP_STRIPE_ROWS >> roundLevels) > 1) roundLevels++;
+    if (roundLevels < 1) roundLevels = 1;
+
+    for (int level = first; level < count; level += roundLevels)
+    {
+        job.first = level;
+        job.last = ((level + roundLevels) < count)? (level + roundLevels - 1) : (count - 1);
+
+        // Stripes of at least 64K source pixels per thread
+        int stripeCount = (job.heights[level - 1] + IMAGE_MIPMAP_STRIPE_ROWS - 1)/IMAGE_MIPMAP_STRIPE_ROWS;
+        int minBand = 65536/(IMAGE_MIPMAP_STRIPE_ROWS*job.widths[level - 1]) + 1;
+
+        ImageParallelFor(stripeCount, minBand, ImageMipmapStripes, &job);
+    }
+
+    RL_FREE(toLinear);
+    RL_FREE(fromLinear);
+}
+
+// Mipmap task: stripes [start, end) of the level before job.first, taken down through levels [job.first, job.last]
+// NOTE: Stripe rows halve at every level, so the rows a stripe needs from the previous level are always its own
+static void ImageMipmapStripes(void *data, int start, int end)
+{
+    ImageMipmapJob *job = (ImageMipmapJob *)data;
+
+    for (int stripe = start; stripe < end; stripe++)
+    {
+        for (int level = job->first; level <= job->last; level++)
+        {
+            int shift = level - job->first + 1;
+            int y0 = (stripe*IMAGE_MIPMAP_STRIPE_ROWS) >> shift;
+            int y1 = ((stripe + 1)*IMAGE_MIPMAP_STRIPE_ROWS) >> shift;
+            if (y1 > job->heights[level]) y1 = job->heights[level];
+
+            for (int y = y0; y < y1; y++) ImageMipmapRow(job, level, y);
+        }
+    }
+}
+
+// Mipmap pixels [x, width) of a row from its two source rows
+static inline void ImageMipmapPixels(const unsigned char *row0, const unsigned char *row1, unsigned char *dst, int x, int width, int srcWidth, int channels)
+{
+    int next = (srcWidth > 1)? channels : 0;    // Levels 1 pixel wide average their only column with itself
+
+    for (; x < width; x++)
+    {
+        const unsigned char *top = row0 + 2*x*channels;
+        const unsigned char *bottom = row1 + 2*x*channels;
+
+        for (int c = 0; c < channels; c++) dst[x*channels + c] = (unsigned char)((top[c] + top[next + c] + bottom[c] + bottom[next + c] + 2) >> 2);
+    }
+}
+
+// Mipmap row: row y of a level as a 2x2 box filter of the previous level, rounded to nearest
+// NOTE: Odd sized levels leave their last row or column out, the same way level sizes are rounded down
+static void ImageMipmapRow(const ImageMipmapJob *job, int level, int y)
+{
+    int channels = job->channels;
+    int srcWidth = job->widths[level - 1];
+    int width = job->widths[level];
+    int y0 = 2*y;
+    int y1 = (y0 + 1 < job->heights[level - 1])? y0 + 1 : y0;
+    const unsigned char *row0 = job->levels[level - 1] + (size_t)y0*srcWidth*channels;
+    const unsigned char *row1 = job->levels[level - 1] + (size_t)y1*srcWidth*channels;
+    unsigned char *dst = job->levels[level] + (size_t)y*width*channels;
+    int x = 0;
+
+    if (job->toLinear != NULL)
+    {
+        // sRGB: color channels averaged as linear values, alpha as it is
+        const unsigned short *toLinear = job->toLinear;
+
+        for (; x < width; x++)
+        {
+            int x0 = 2*x*channels;
+            int x1 = (2*x + 1 < srcWidth)? x0 + channels : x0;
+
+            for (int c = 0; c < channels; c++)
+            {
+                if (c == job->alphaChannel) dst[x*channels + c] = (unsigned char)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+                else dst[x*channels + c] = job->fromLinear[toLinear[row0[x0 + c]] + toLinear[row0[x1 + c]] + toLinear[row1[x0 + c]] + toLinear[row1[x1 + c]]];
+            }
+        }
+
+        return;
+    }
+
+#if defined(RL_TEXTURES_SSE2)
+    // Levels wider than 1 pixel are half the previous width, so every destination pixel has both its source columns
+    if (srcWidth > 1)
+    {
+        __m128i two = _mm_set1_epi16(2);
+        __m128i zero = _mm_setzero_si128();
+
+        if (channels == 4)
+        {
+            // 4 pixels from 8: vertical sums in 16 bit, then neighbour pixels added through their 64-bit halves
+            for (; x + 4 <= width; x += 4)
+            {
+                __m128i sums[2];
+
+                for (int i = 0; i < 2; i++)
+                {
+                    __m128i top = _mm_loadu_si128((const __m128i *)(row0 + x*8 + i*16));
+                    __m128i bottom = _mm_loadu_si128((const __m128i *)(row1 + x*8 + i*16));
+                    __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+                    __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+                    __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+
+                    sums[i] = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+                }
+
+                _mm_storeu_si128((__m128i *)(dst + x*4), _mm_packus_epi16(sums[0], sums[1]));
+            }
+        }
+        else if (channels == 2)
+        {
+            // 8 pixels from 16: vertical sums in 16 bit, then even and odd pixels (32-bit lanes) split apart and added
+            for (; x + 8 <= width; x += 8)
+            {
+                __m128i sums[2];
+
+                for (int i = 0; i < 2; i++)
+                {
+                    __m128i top = _mm_loadu_si128((const __m128i *)(row0 + x*4 + i*16));
+                    __m128i bottom = _mm_loadu_si128((const __m128i *)(row1 + x*4 + i*16));
+                    __m128 lo = _mm_castsi128_ps(_mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero)));
+                    __m128 hi = _mm_castsi128_ps(_mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero)));
+                    __m128i sum = _mm_add_epi16(_mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0))),
+                        _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1))));
+
+                    sums[i] = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+                }
+
+                _mm_storeu_si128((__m128i *)(dst + x*2), _mm_packus_epi16(sums[0], sums[1]));
+            }
+        }
+        else if (channels == 1)
+        {
+            // 16 pixels from 32: even and odd columns split out of 16-bit lanes
+            __m128i mask = _mm_set1_epi16(0xff);
+
+            for (; x + 16 <= width; x += 16)
+            {
+                __m128i sums[2];
+
+                for (int i = 0; i < 2; i++)
+                {
+                    __m128i top = _mm_loadu_si128((const __m128i *)(row0 + x*2 + i*16));
+                    __m128i bottom = _mm_loadu_si128((const __m128i *)(row1 + x*2 + i*16));
+                    __m128i sum = _mm_add_epi16(_mm_add_epi16(_mm_and_si128(top, mask), _mm_srli_epi16(top, 8)),
+                        _mm_add_epi16(_mm_and_si128(bottom, mask), _mm_srli_epi16(bottom, 8)));
+
+                    sums[i] = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+                }
+
+                _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(sums[0], sums[1]));
+            }
+        }
+    }
+#endif
+
+    // Constant channel counts, so the channels loop is unrolled
+    switch (channels)
+    {
+        case 1: ImageMipmapPixels(row0, row1, dst, x, width, srcWidth, 1); break;
+        case 2: ImageMipmapPixels(row0, row1, dst, x, width, srcWidth, 2); break;
+        case 3: ImageMipmapPixels(row0, row1, dst, x, width, srcWidth, 3); break;
+        default: ImageMipmapPixels(row0, row1, dst, x, width, srcWidth, 4); break;
+    }
+}
+#endif
+
+#if defined(RL_TEXTURES_THREADS)
+// Thread running one band of a task
+typedef struct ImageTaskThread {
+    ImageTaskCallback task;     // Task to run
+    void *data;                 // Task data
+    int start;                  // First item of the band
+    int end;                    // One past the last item of the band
+} ImageTaskThread;
+
+#if defined(RL_TEXTURES_THREADS_WIN32)
+static unsigned int __stdcall ImageTaskThreadMain(void *arg)
+#else
+static void *ImageTaskThreadMain(void *arg)
+#endif
+{
+    ImageTaskThread *thread = (ImageTaskThread *)arg;
+    thread->task(thread->data, thread->start, thread->end);
+
+    return 0;
+}
+#endif
+
+// Get number of threads image processing functions split work across
+static int GetImageThreadCount(void)
+{
+    static int threadCount = 0;     // CPU count is only queried once
+
+    if (threadCount == 0)
+    {
+        int count = 1;
+    #if defined(RL_TEXTURES_THREADS_WIN32)
+        count = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+    #elif defined(RL_TEXTURES_THREADS_PTHREAD)
+        count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+        if (count < 1) count = 1;
+        if (count > MAX_IMAGE_THREADS) count = MAX_IMAGE_THREADS;
+
+        threadCount = count;
+    }
+
+    return threadCount;
+}
+
+// Run task over items [0, count), split in even bands of at least minBand items across threads
+// NOTE: Returns once all bands are done, the calling thread runs the first band
+static void ImageParallelFor(int count, int minBand, ImageTaskCallback task, void *data)
+{
+    if (count <= 0) return;
+    if (minBand < 1) minBand = 1;
+
+    int threadCount = GetImageThreadCount();
+    if (threadCount > count/minBand) threadCount = count/minBand;
+
+    if (threadCount <= 1)
+    {
+        task(data, 0, count);
+        return;
+    }
+
+#if defined(RL_TEXTURES_THREADS)
+    ImageTaskThread threads[MAX_IMAGE_THREADS] = { 0 };
+#if defined(RL_TEXTURES_THREADS_WIN32)
+    uintptr_t handles[MAX_IMAGE_THREADS] = { 0 };
+#else
+    pthread_t handles[MAX_IMAGE_THREADS] = { 0 };
+#endif
+    bool started[MAX_IMAGE_THREADS] = { 0 };
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        threads[i].task = task;
+        threads[i].data = data;
+        threads[i].start = (int)((long long)count*i/threadCount);
+        threads[i].end = (int)((long long)count*(i + 1)/threadCount);
+    }
+
+    for (int i = 1; i < threadCount; i++)
+    {
+    #if defined(RL_TEXTURES_THREADS_WIN32)
+        handles[i] = _beginthreadex(NULL, 0, ImageTaskThreadMain, &threads[i], 0, NULL);
+        started[i] = (handles[i] != 0);
+    #else
+        started[i] = (pthread_create(&handles[i], NULL, ImageTaskThreadMain, &threads[i]) == 0);
+    #endif
+        // Run the band here if the thread could not be created
+        if (!started[i]) task(data, threads[i].start, threads[i].end);
+    }
+
+    task(data, threads[0].start, threads[0].end);
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        if (!started[i]) continue;
+    #if defined(RL_TEXTURES_THREADS_WIN32)
+        WaitForSingleObject((void *)handles[i], 0xffffffff);    // INFINITE
+        CloseHandle((void *)handles[i]);
+    #else
+        pthread_join(handles[i], NULL);
+    #endif
+    }
+#endif
+}
+
+// Copy one pixel of bytesPerPixel bytes
+static inline void CopyImagePixel(unsigned char *dst, const unsigned char *src, int bytesPerPixel)
+{
+    switch (bytesPerPixel)
+    {
+        case 1: dst[0] = src[0]; break;
+        case 2: memcpy(dst, src, 2); break;
+        case 3: memcpy(dst, src, 3); break;
+        case 4: memcpy(dst, src, 4); break;
+        default: memcpy(dst, src, bytesPerPixel); break;
+    }
+}
+
+// Nearest-Neighbor resize task: destination rows [start, end)
+// NOTE: Destination rows sampling the same source row are copied from the previous one
+static void ImageResizeRowsNN(void *data, int start, int end)
+{
+    ImageTransformJob *job = (ImageTransformJob *)data;
+    int bytesPerPixel = job->bytesPerPixel;
+    int rowSize = job->dstWidth*bytesPerPixel;
+    int previousY = -1;
+
+    for (int y = start; y < end; y++)
+    {
+        int y2 = ((y*job->yRatio) >> 16);
+        unsigned char *dst = job->dst + (size_t)y*rowSize;
+
+        if (y2 == previousY)
+        {
+            memcpy(dst, dst - rowSize, rowSize);
+            continue;
+        }
+
+        const unsigned char *src = job->src + (size_t)y2*job->width*bytesPerPixel;
+
+        if (bytesPerPixel == 4) for (int x = 0; x < job->dstWidth; x++) memcpy(dst + x*4, src + job->offsets[x], 4);
+        else for (int x = 0; x < job->dstWidth; x++) CopyImagePixel(dst + x*bytesPerPixel, src + job->offsets[x], bytesPerPixel);
+
+        previousY = y2;
+    }
+}
+
+// Vertical flip task: swap rows y and height - 1 - y for y in [start, end)
+static void ImageFlipRows(void *data, int start, int end)
+{
+    ImageTransformJob *job = (ImageTransformJob *)data;
+    int rowSize = job->width*job->bytesPerPixel;
+    unsigned char buffer[4096] = { 0 };
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *top = job->src + (size_t)y*rowSize;
+        unsigned char *bottom = job->src + (size_t)(job->height - 1 - y)*rowSize;
+
+        for (int i = 0; i < rowSize; i += 4096)
+        {
+            int size = ((rowSize - i) < 4096)? (rowSize - i) : 4096;
+
+            memcpy(buffer, top + i, size);
+            memcpy(top + i, bottom + i, size);
+            memcpy(bottom + i, buffer, size);
+        }
+    }
+}
+
+// Horizontal flip task: reverse rows [start, end) in place, swapping pixels from both ends
+static void ImageMirrorRows(void *data, int start, int end)
+{
+    ImageTransformJob *job = (ImageTransformJob *)data;
+    int bytesPerPixel = job->bytesPerPixel;
+    unsigned char pixel[16] = { 0 };    // Largest pixel: R32G32B32A32
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *row = job->src + (size_t)y*job->width*bytesPerPixel;
+        int left = 0;
+        int right = job->width - 1;
+
+    #if defined(RL_TEXTURES_SSE2)
+        // 32-bit pixels: 4 from each end, reversed in register
+        if (bytesPerPixel == 4)
+        {
+            for (; left + 3 < right - 3; left += 4, right -= 4)
+            {
+                __m128i leftPixels = _mm_loadu_si128((__m128i *)(row + left*4));
+                __m128i rightPixels = _mm_loadu_si128((__m128i *)(row + (right - 3)*4));
+
+                _mm_storeu_si128((__m128i *)(row + left*4), _mm_shuffle_epi32(rightPixels, _MM_SHUFFLE(0, 1, 2, 3)));
+                _mm_storeu_si128((__m128i *)(row + (right - 3)*4), _mm_shuffle_epi32(leftPixels, _MM_SHUFFLE(0, 1, 2, 3)));
+            }
+        }
+    #endif
+
+        for (; left < right; left++, right--)
+        {
+            CopyImagePixel(pixel, row + left*bytesPerPixel, bytesPerPixel);
+            CopyImagePixel(row + left*bytesPerPixel, row + right*bytesPerPixel, bytesPerPixel);
+            CopyImagePixel(row + right*bytesPerPixel, pixel, bytesPerPixel);
+        }
+    }
+}
+
+// 90deg rotation task: destination rows [start, end), in tiles of 32x32 pixels so both source and destination stay in cache
+// NOTE: Clockwise, destination (x, y) is source (y, height - 1 - x); counter-clockwise, it is source (width - 1 - y, x)
+static void ImageRotateRows(void *data, int start, int end)
+{
+    ImageTransformJob *job = (ImageTransformJob *)data;
+    const unsigned char *src = job->src;
+    unsigned char *dst = job->dst;
+    int width = job->width;
+    int height = job->height;
+    int bytesPerPixel = job->bytesPerPixel;
+
+    // Destination is height pixels wide, one row for every source column
+    for (int tileY = start; tileY < end; tileY += 32)
+    {
+        int tileEndY = ((tileY + 32) < end)? (tileY + 32) : end;
+
+        for (int tileX = 0; tileX < height; tileX += 32)
+        {
+            int tileEndX = ((tileX + 32) < height)? (tileX + 32) : height;
+            int y = tileY;
+
+        #if defined(RL_TEXTURES_SSE2)
+            // 32-bit pixels: blocks of 4x4 pixels transposed in registers
+            if (bytesPerPixel == 4)
+            {
+                for (; y + 4 <= tileEndY; y += 4)
+                {
+                    int x = tileX;
+
+                    for (; x + 4 <= tileEndX; x += 4)
+                    {
+                        __m128i rows[4];
+
+                        // rows[i] holds destination pixels (y..y + 3, x + i), a column of the 4x4 block
+                        for (int i = 0; i < 4; i++)
+                        {
+                            if (job->clockwise) rows[i] = _mm_loadu_si128((__m128i *)(src + ((size_t)(height - 1 - x - i)*width + y)*4));
+                            else rows[i] = _mm_shuffle_epi32(_mm_loadu_si128((__m128i *)(src + ((size_t)(x + i)*width + width - 4 - y)*4)), _MM_SHUFFLE(0, 1, 2, 3));
+                        }
+
+                        __m128i low01 = _mm_unpacklo_epi32(rows[0], rows[1]);
+                        __m128i low23 = _mm_unpacklo_epi32(rows[2], rows[3]);
+                        __m128i high01 = _mm_unpackhi_epi32(rows[0], rows[1]);
+                        __m128i high23 = _mm_unpackhi_epi32(rows[2], rows[3]);
+
+                        _mm_storeu_si128((__m128i *)(dst + ((size_t)y*height + x)*4), _mm_unpacklo_epi64(low01, low23));
+                        _mm_storeu_si128((__m128i *)(dst + ((size_t)(y + 1)*height + x)*4), _mm_unpackhi_epi64(low01, low23));
+                        _mm_storeu_si128((__m128i *)(dst + ((size_t)(y + 2)*height + x)*4), _mm_unpacklo_epi64(high01, high23));
+                        _mm_storeu_si128((__m128i *)(dst + ((size_t)(y + 3)*height + x)*4), _mm_unpackhi_epi64(high01, high23));
+                    }
+
+                    // Tile columns left out of the 4x4 blocks
+                    for (; x < tileEndX; x++)
+                    {
+                        for (int i = 0; i < 4; i++)
+                        {
+                            size_t srcIndex = job->clockwise? ((size_t)(height - 1 - x)*width + y + i) : ((size_t)x*width + width - 1 - y - i);
+                            memcpy(dst + ((size_t)(y + i)*height + x)*4, src + srcIndex*4, 4);
+                        }
+                    }
+                }
+            }
+        #endif
+
+            for (; y < tileEndY; y++)
+            {
+                for (int x = tileX; x < tileEndX; x++)
+                {
+                    size_t srcIndex = job->clockwise? ((size_t)(height - 1 - x)*width + y) : ((size_t)x*width + width - 1 - y);
+                    CopyImagePixel(dst + ((size_t)y*height + x)*bytesPerPixel, src + srcIndex*bytesPerPixel, bytesPerPixel);
+                }
+            }
+        }
+    }
+}
+
+// Load an empty color hash table with room for maxColors
+static void LoadColorTable(ColorTable *table, int maxColors)
+{
+    table->size = 2;
+    table->shift = 31;
+
+    while (table->size < 2*maxColors)
+    {
+        table->size *= 2;
+        table->shift--;
+    }
+
+    table->keys = (unsigned int *)RL_CALLOC(table->size, sizeof(unsigned int));
+    table->indices = (int *)RL_MALLOC(table->size*sizeof(int));
+}
+
+// Unload color hash table
+static void UnloadColorTable(ColorTable *table)
+{
+    RL_FREE(table->keys);
+    RL_FREE(table->indices);
+}
+
+// Get slot holding key, or the empty slot where it goes (linear probing)
+// NOTE: Table is never more than half full, so there is always an empty slot
+static int GetColorTableSlot(const ColorTable *table, unsigned int key)
+{
+    unsigned int mask = (unsigned int)table->size - 1;
+    unsigned int slot = (key*2654435761u) >> table->shift;     // Fibonacci hashing, top bits of the product
+
+    while ((table->keys[slot] != 0) && (table->keys[slot] != key)) slot = (slot + 1) & mask;
+
+    return (int)slot;
+}
+
+// Palette task: colors of bands [start, end), with their pixels count
+// NOTE: A band stops when its colors reach the palette size
+static void ImagePaletteBands(void *data, int start, int end)
+{
+    ImagePaletteJob *job = (ImagePaletteJob *)data;
+    Color buffer[256] = { 0 };
+
+    for (int b = start; b < end; b++)
+    {
+        ImagePaletteBand *band = &job->bands[b];
+        int first = (int)((long long)job->pixelCount*b/job->bandCount);
+        int last = (int)((long long)job->pixelCount*(b + 1)/job->bandCount);
+        unsigned int lastKey = 0;   // Runs of the same color skip the table
+        int lastIndex = 0;
+
+        for (int i = first; (i < last) && !band->full; i += 256)
+        {
+            int count = ((last - i) < 256)? (last - i) : 256;
+            const Color *pixels = buffer;
+
+            if (job->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) pixels = (const Color *)(job->data + (size_t)i*4);
+            else ConvertPixelsToColors(job->data + (size_t)i*job->bytesPerPixel, job->format, count, buffer);
+
+            for (int k = 0; k < count; k++)
+            {
+                if (pixels[k].a == 0) continue;
+
+                unsigned int key = 0;
+                memcpy(&key, &pixels[k], 4);
+
+                if (key == lastKey)
+                {
+                    band->counts[lastIndex]++;
+                    continue;
+                }
+
+                int slot = GetColorTableSlot(&band->table, key);
+
+                if (band->table.keys[slot] != key)
+                {
+                    band->table.keys[slot] = key;
+                    band->table.indices[slot] = band->colorCount;
+                    band->colors[band->colorCount] = pixels[k];
+                    band->colorCount++;
+                }
+
+                lastKey = key;
+                lastIndex = band->table.indices[slot];
+                band->counts[lastIndex]++;
+
+                if (band->colorCount >= job->maxPaletteSize)
+                {
+                    band->full = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Palette task: count pixels of the palette colors in bands [start, end), band counts are per palette color
+static void ImagePaletteCountBands(void *data, int start, int end)
+{
+    ImagePaletteJob *job = (ImagePaletteJob *)data;
+    const ColorTable *table = job->palette;
+    Color buffer[256] = { 0 };
+
+    for (int b = start; b < end; b++)
+    {
+        ImagePaletteBand *band = &job->bands[b];
+        int first = (int)((long long)job->pixelCount*b/job->bandCount);
+        int last = (int)((long long)job->pixelCount*(b + 1)/job->bandCount);
+
+        for (int i = first; i < last; i += 256)
+        {
+            int count = ((last - i) < 256)? (last - i) : 256;
+            const Color *pixels = buffer;
+
+            if (job->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) pixels = (const Color *)(job->data + (size_t)i*4);
+            else ConvertPixelsToColors(job->data + (size_t)i*job->bytesPerPixel, job->format, count, buffer);
+
+            for (int k = 0; k < count; k++)
+            {
+                if (pixels[k].a == 0) continue;
+
+                unsigned int key = 0;
+                memcpy(&key, &pixels[k], 4);
+                int slot = GetColorTableSlot(table, key);
+
+                if (table->keys[slot] == key) band->counts[table->indices[slot]]++;
+            }
+        }
+    }
+}
+
+// Get size and format of an image file data without decoding it
+// NOTE: Only file formats decoded to a single uncompressed 8-bit per channel image are supported
+static bool GetImageInfoFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *width, int *height, int *format)
+{
+    bool result = false;
+
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    if ((strcmp(fileType, ".qoi") == 0) || (strcmp(fileType, ".QOI") == 0))
+    {
+        // QOI header: magic "qoif", width and height (big endian), channels
+        if ((dataSize >= 14) && (memcmp(fileData, "qoif", 4) == 0))
+        {
+            *width = (int)(((unsigned int)fileData[4] << 24) | (fileData[5] << 16) | (fileData[6] << 8) | fileData[7]);
+            *height = (int)(((unsigned int)fileData[8] << 24) | (fileData[9] << 16) | (fileData[10] << 8) | fileData[11]);
+            *format = (fileData[12] == 4)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+            result = (*width > 0) && (*height > 0);
+        }
+
+        return result;
+    }
+#endif
+
+#if defined(STBI_REQUIRED)
+    int comp = 0;
+
+    if (!stbi_is_hdr_from_memory(fileData, dataSize) && stbi_info_from_memory(fileData, dataSize, width, height, &comp))
+    {
+        if (comp == 1) *format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+        else if (comp == 2) *format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        else if (comp == 3) *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+        else if (comp == 4) *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        result = (comp >= 1) && (comp <= 4) && (*width > 0) && (*height > 0);
+    }
+#endif
+
+    return result;
+}
+
+// Upload decoded image of a job to its texture and remove job from the queue
+static void UploadTextureQueueJob(TextureQueueJob *job)
+{
+    Image image = job->image;
+
+    if (!job->canceled)
+    {
+        if ((image.data != NULL) && (image.format != job->format)) ImageFormat(&image, job->format);
+
+        if (image.data == NULL) TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to decode queued texture image data", job->id);
+        else if ((image.width != job->width) || (image.height != job->height)) TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Queued texture image size changed while decoding", job->id);
+        else
+        {
+            rlUpdateTexture(job->id, 0, 0, image.width, image.height, image.format, image.data);
+            TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Queued texture data uploaded to VRAM (GPU)", job->id);
+        }
+    }
+
+    for (int i = 0; i < textureQueue.jobCount; i++)
+    {
+        if (textureQueue.jobs[i] == job)
+        {
+            memmove(&textureQueue.jobs[i], &textureQueue.jobs[i + 1], (textureQueue.jobCount - i - 1)*sizeof(TextureQueueJob *));
+            textureQueue.jobCount--;
+            break;
+        }
+    }
+
+    UnloadImage(image);
+    if (job->mapped) UnloadFileMapped(job->fileData, job->dataSize);
+    else UnloadFileData(job->fileData);
+    RL_FREE(job);
+}
+
+// Cancel job queued for a texture, if any
+// NOTE: Jobs still decoding on a worker are only marked, they are removed when their result comes back
+static void CancelTextureQueueJob(unsigned int id)
+{
+    for (int i = 0; i < textureQueue.jobCount; i++)
+    {
+        TextureQueueJob *job = textureQueue.jobs[i];
+
+        if ((job->id == id) && !job->canceled)
+        {
+            job->canceled = true;
+            if (!job->decoding) UploadTextureQueueJob(job);
+            break;
+        }
+    }
+}
+
+// Copy pixels into an atlas page, at rectangle (x, y) of (width + 2*padding) x (height + 2*padding)
+// NOTE: Gutter of padding pixels around the pixels repeats their edge pixels
+static void CopyAtlasPixels(Color *page, int pageWidth, const Color *pixels, int width, int height, int x, int y, int padding)
+{
+    for (int row = -padding; row < (height + padding); row++)
+    {
+        const Color *src = pixels + (size_t)((row < 0)? 0 : ((row >= height)? height - 1 : row))*width;
+        Color *dst = page + (size_t)(y + padding + row)*pageWidth + x;
+
+        for (int i = 0; i < padding; i++) dst[i] = src[0];
+        memcpy(dst + padding, src, width*sizeof(Color));
+        for (int i = 0; i < padding; i++) dst[padding + width + i] = src[width - 1];
+    }
+}
+
+#if defined(RL_TEXTURES_THREADS)
+// Push job into a ring, producer side
+static bool PushTextureQueueJob(TextureQueueRing *ring, TextureQueueJob *job)
+{
+    long tail = ring->tail;
+
+    if ((tail - ATOMIC_LOAD(&ring->head)) >= TEXTURE_QUEUE_RING_SIZE) return false;
+
+    ring->jobs[tail & (TEXTURE_QUEUE_RING_SIZE - 1)] = job;
+    ATOMIC_STORE(&ring->tail, tail + 1);     // Job is visible to the consumer after this store
+
+    return true;
+}
+
+// Pop job from a ring, consumer side
+static bool PopTextureQueueJob(TextureQueueRing *ring, TextureQueueJob **job)
+{
+    long head = ring->head;
+
+    if (head == ATOMIC_LOAD(&ring->tail)) return false;
+
+    *job = ring->jobs[head & (TEXTURE_QUEUE_RING_SIZE - 1)];
+    ATOMIC_STORE(&ring->head, head + 1);     // Slot can be reused by the producer after this store
+
+    return true;
+}
+
+// Texture loading queue worker thread: decodes jobs until its requests ring is empty
+#if defined(RL_TEXTURES_THREADS_WIN32)
+static unsigned int __stdcall TextureQueueWorkerMain(void *arg)
+#else
+static void *TextureQueueWorkerMain(void *arg)
+#endif
+{
+    TextureQueueWorker *worker = (TextureQueueWorker *)arg;
+    TextureQueueJob *job = NULL;
+
+    while (true)
+    {
+        while (!ATOMIC_LOAD(&textureQueue.stop) && PopTextureQueueJob(&worker->requests, &job))
+        {
+            job->image = LoadImageFromMemory(job->fileType, job->fileData, job->dataSize);
+            if (job->mapped) UnloadFileMapped(job->fileData, job->dataSize);
+            else UnloadFileData(job->fileData);
+            job->fileData = NULL;
+
+            // NOTE: Results ring can not be full, the main thread never sends more jobs than it holds
+            PushTextureQueueJob(&worker->results, job);
+        }
+
+        // Clear running flag, then check the ring again: the main thread only starts
+        // a new thread for jobs pushed after it saw the flag cleared
+        ATOMIC_STORE(&worker->running, 0);
+
+        if (ATOMIC_LOAD(&textureQueue.stop) || (ATOMIC_LOAD(&worker->requests.tail) == worker->requests.head)) break;
+        if (ATOMIC_EXCHANGE(&worker->running, 1) != 0) break;   // A new thread took over
+    }
+
+    return 0;
+}
+
+// Send jobs waiting in the queue to workers with room for them, starting worker threads as required
+static void SendTextureQueueJobs(void)
+{
+    if (textureQueue.workerCount == 0)
+    {
+        // Main thread runs the uploads, keep one CPU for it
+        textureQueue.workerCount = GetImageThreadCount() - 1;
+        if (textureQueue.workerCount < 1) textureQueue.workerCount = 1;
+    }
+
+    for (int i = 0; i < textureQueue.jobCount; i++)
+    {
+        TextureQueueJob *job = textureQueue.jobs[i];
+
+        if (job->decoding || job->canceled) continue;
+
+        // Worker with less jobs, stop once all of them are full
+        TextureQueueWorker *worker = &textureQueue.workers[0];
+        for (int w = 1; w < textureQueue.workerCount; w++)
+        {
+            if (textureQueue.workers[w].jobCount < worker->jobCount) worker = &textureQueue.workers[w];
+        }
+
+        if (worker->jobCount >= TEXTURE_QUEUE_RING_SIZE) break;
+
+        PushTextureQueueJob(&worker->requests, job);
+        job->decoding = true;
+        worker->jobCount++;
+
+        if (ATOMIC_EXCHANGE(&worker->running, 1) == 0)
+        {
+            // Previous thread is exiting or already gone
+            if (worker->started)
+            {
+            #if defined(RL_TEXTURES_THREADS_WIN32)
+                WaitForSingleObject((void *)worker->handle, 0xffffffff);    // INFINITE
+                CloseHandle((void *)worker->handle);
+            #else
+                pthread_join(worker->handle, NULL);
+            #endif
+            }
+
+        #if defined(RL_TEXTURES_THREADS_WIN32)
+            worker->handle = _beginthreadex(NULL, 0, TextureQueueWorkerMain, worker, 0, NULL);
+            worker->started = (worker->handle != 0);
+        #else
+            worker->started = (pthread_create(&worker->handle, NULL, TextureQueueWorkerMain, worker) == 0);
+        #endif
+            // Decode here if the thread could not be created
+            if (!worker->started) TextureQueueWorkerMain(worker);
+        }
+    }
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXTURES
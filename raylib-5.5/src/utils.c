@@ -49,6 +49,26 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+// Memory mapped files, LoadFileMapped() returns NULL without them
+#if defined(SUPPORT_STANDARD_FILEIO) && !defined(PLATFORM_ANDROID) && !defined(__EMSCRIPTEN__)
+    #if defined(_WIN32)
+        // NOTE: Declaring functions required from windows.h to avoid including it
+        __declspec(dllimport) void *__stdcall CreateFileA(const char *lpFileName, unsigned long dwDesiredAccess, unsigned long dwShareMode, void *lpSecurityAttributes, unsigned long dwCreationDisposition, unsigned long dwFlagsAndAttributes, void *hTemplateFile);
+        __declspec(dllimport) int __stdcall GetFileSizeEx(void *hFile, long long *lpFileSize);
+        __declspec(dllimport) void *__stdcall CreateFileMappingA(void *hFile, void *lpFileMappingAttributes, unsigned long flProtect, unsigned long dwMaximumSizeHigh, unsigned long dwMaximumSizeLow, const char *lpName);
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *hFileMappingObject, unsigned long dwDesiredAccess, unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow, size_t dwNumberOfBytesToMap);
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *lpBaseAddress);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        #define RL_FILE_MAPPING_WIN32
+    #elif defined(__unix__) || defined(__APPLE__)
+        #include <fcntl.h>              // Required for: open()
+        #include <unistd.h>             // Required for: close()
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #include <sys/stat.h>           // Required for: fstat()
+        #define RL_FILE_MAPPING_POSIX
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -250,6 +270,81 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Load file data mapped in memory (read-only), pages are read from disk on first access
+// NOTE: Returns NULL if the file can not be mapped (no memory mapped files support, custom
+// LoadFileData callback set, empty or missing file...), use LoadFileData() in that case
+unsigned char *LoadFileMapped(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+    if ((fileName == NULL) || (loadFileData != NULL)) return NULL;
+
+#if defined(RL_FILE_MAPPING_WIN32)
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);  // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+    if (file != (void *)-1)     // INVALID_HANDLE_VALUE
+    {
+        long long size = 0;
+
+        if (GetFileSizeEx(file, &size) && (size > 0) && (size <= 2147483647))
+        {
+            void *mapping = CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL);   // PAGE_READONLY
+
+            if (mapping != NULL)
+            {
+                data = (unsigned char *)MapViewOfFile(mapping, 0x0004, 0, 0, 0);   // FILE_MAP_READ
+                CloseHandle(mapping);   // View keeps the mapping alive
+            }
+        }
+
+        if (data != NULL) *dataSize = (int)size;
+
+        CloseHandle(file);
+    }
+#elif defined(RL_FILE_MAPPING_POSIX)
+    int file = open(fileName, O_RDONLY);
+
+    if (file >= 0)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(file, &info) == 0) && (info.st_size > 0) && (info.st_size <= 2147483647))
+        {
+            void *mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+            if (mapping != MAP_FAILED)
+            {
+                data = (unsigned char *)mapping;
+                *dataSize = (int)info.st_size;
+            }
+        }
+
+        close(file);    // Mapping stays valid
+    }
+#endif
+
+    if (data != NULL) TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+    else TRACELOGD("FILEIO: [%s] File could not be mapped", fileName);
+
+    return data;
+}
+
+// Unload file data mapped by LoadFileMapped()
+void UnloadFileMapped(unsigned char *data, int dataSize)
+{
+    if (data == NULL) return;
+
+#if defined(RL_FILE_MAPPING_WIN32)
+    (void)dataSize;
+    UnmapViewOfFile(data);
+#elif defined(RL_FILE_MAPPING_POSIX)
+    munmap(data, (size_t)dataSize);
+#else
+    (void)dataSize;
+#endif
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, int dataSize)
 {